@@ -18,6 +18,9 @@ mkdir ${BUILDDIR}
 # build
 make > ${BUILDDIR}/${LOGFILE}.txt
 
+# compile dictionaries so cw_gen maps them instead of parsing json
+make dicts >> ${BUILDDIR}/${LOGFILE}.txt
+
 # clean up
 mv *.o ${BUILDDIR}
 cd ..
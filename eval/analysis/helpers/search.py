@@ -13,6 +13,7 @@ class SearchReason(Enum):
     AC3 = "ac3"
     SOLVED = "solved"
     DUPLICATE = "duplicate"
+    NOGOOD = "nogood"
 
     @classmethod
     def from_string(cls, value):
@@ -26,6 +27,7 @@ class Color(Enum):
     YELLOW = "#fff2cc"
     ORANGE = "#f5d6b0"
     RED = "#f8cecc"
+    PURPLE = "#e1d5e7"
 
 class SearchNode:
     def __init__(self, success:bool, reason:SearchReason, word=None, parent=None):
@@ -104,6 +106,8 @@ class SearchNode:
                     return Color.RED.value
                 case SearchReason.DUPLICATE:
                     return Color.ORANGE.value
+                case SearchReason.NOGOOD:
+                    return Color.PURPLE.value
                 case _:
                     raise ValueError(f"Node with success={self.success} and reason={self.reason.value} has no valid color")
 
@@ -188,7 +192,7 @@ class SearchNode:
                 return data
             else:
                 total_constrs_checked = gather_recursive_ccde(self)
-                assert(total_constrs_checked > 0 or self.reason == SearchReason.DUPLICATE)
+                assert(total_constrs_checked > 0 or self.reason in (SearchReason.DUPLICATE, SearchReason.NOGOOD))
                 return [total_constrs_checked]
         else:
             if self.success:
@@ -196,7 +200,7 @@ class SearchNode:
                     child.gather_exclusive_ccde_data(result)
             else:
                 total_constrs_checked = gather_recursive_ccde(self)
-                assert(total_constrs_checked > 0 or self.reason == SearchReason.DUPLICATE)
+                assert(total_constrs_checked > 0 or self.reason in (SearchReason.DUPLICATE, SearchReason.NOGOOD))
                 result.append(total_constrs_checked)
 
     # returns list of exclusive pairs pruned per dead end (PPDE), i.e. hierarchical counting, avoiding nested subtrees
@@ -217,7 +221,7 @@ class SearchNode:
                 return data
             else:
                 total_pairs_pruned = gather_recursive_ppde(self)
-                assert(total_pairs_pruned > 0 or self.reason == SearchReason.DUPLICATE)
+                assert(total_pairs_pruned > 0 or self.reason in (SearchReason.DUPLICATE, SearchReason.NOGOOD))
                 return [total_pairs_pruned]
         else:
             if self.success:
@@ -225,7 +229,7 @@ class SearchNode:
                     child.gather_exclusive_ppde_data(result)
             else:
                 total_pairs_pruned = gather_recursive_ppde(self)
-                assert(total_pairs_pruned > 0 or self.reason == SearchReason.DUPLICATE)
+                assert(total_pairs_pruned > 0 or self.reason in (SearchReason.DUPLICATE, SearchReason.NOGOOD))
                 result.append(total_pairs_pruned)
 
     # returns two list of number of nodes at each depth: {"no_leaves": without leaves, "leaves": with leaves}
@@ -306,12 +310,12 @@ def gather_search_tree(data) -> SearchNode:
 
             # compensate for leaf nodes in a dead end currently not being annotated with jump_height due to no search step underneath
             if len(node_child.children) == 0 and not node_child.success:
-                assert(node_child.reason == SearchReason.AC3 or node_child.reason == SearchReason.DUPLICATE)
+                assert(node_child.reason in (SearchReason.AC3, SearchReason.DUPLICATE, SearchReason.NOGOOD))
                 assert(node_child.jump_height is None)
                 node_child.set_jump_height(1)
 
-            # annotate duplicate nodes with prune data since no AC-3 was performed underneath
-            if node_child.reason == SearchReason.DUPLICATE:
+            # annotate duplicate & nogood nodes with prune data since no AC-3 was performed underneath
+            if node_child.reason in (SearchReason.DUPLICATE, SearchReason.NOGOOD):
                 assert(len(node_child.children) == 0)
                 assert(not node_child.success)
                 node_child.set_num_constrs(0, 0)
@@ -700,26 +704,37 @@ def analyze_search(data, output_dir) -> bool:
         file.write("## Search Metrics\n\n")
 
         file.write("### Search node reasons\n")
-        file.write("| Result | Total | Solved | Recursive | AC3 | Duplicate |\n")
-        file.write("|--------|-------|--------|-----------|-----|-----------|\n")
+        file.write("| Result | Total | Solved | Recursive | AC3 | Duplicate | Nogood |\n")
+        file.write("|--------|-------|--------|-----------|-----|-----------|--------|\n")
         success_reasons = [
             sum(reason_data[True].values()),
             reason_data[True].get(SearchReason.SOLVED, 0),
             reason_data[True].get(SearchReason.RECURSIVE, 0),
             reason_data[True].get(SearchReason.AC3, 0),
-            reason_data[True].get(SearchReason.DUPLICATE, 0)
+            reason_data[True].get(SearchReason.DUPLICATE, 0),
+            reason_data[True].get(SearchReason.NOGOOD, 0)
         ]
         fail_reasons = [
             sum(reason_data[False].values()),
             reason_data[False].get(SearchReason.SOLVED, 0),
             reason_data[False].get(SearchReason.RECURSIVE, 0),
             reason_data[False].get(SearchReason.AC3, 0),
-            reason_data[False].get(SearchReason.DUPLICATE, 0)
+            reason_data[False].get(SearchReason.DUPLICATE, 0),
+            reason_data[False].get(SearchReason.NOGOOD, 0)
         ]
         all_reasons = [sum(x) for x in zip(success_reasons, fail_reasons)]
-        file.write(f"| All | {all_reasons[0]} | {all_reasons[1]} | {all_reasons[2]} | {all_reasons[3]} | {all_reasons[4]} |\n")
-        file.write(f"| Success | {success_reasons[0]} | {success_reasons[1]} | {success_reasons[2]} | {success_reasons[3]} | {success_reasons[4]} |\n")
-        file.write(f"| Fail | {fail_reasons[0]} | {fail_reasons[1]} | {fail_reasons[2]} | {fail_reasons[3]} | {fail_reasons[4]} |\n")
+        file.write(f"| All | {all_reasons[0]} | {all_reasons[1]} | {all_reasons[2]} | {all_reasons[3]} | {all_reasons[4]} | {all_reasons[5]} |\n")
+        file.write(f"| Success | {success_reasons[0]} | {success_reasons[1]} | {success_reasons[2]} | {success_reasons[3]} | {success_reasons[4]} | {success_reasons[5]} |\n")
+        file.write(f"| Fail | {fail_reasons[0]} | {fail_reasons[1]} | {fail_reasons[2]} | {fail_reasons[3]} | {fail_reasons[4]} | {fail_reasons[5]} |\n")
+
+        file.write("### Nogoods\n")
+        file.write("| Learned | Hits | Evicted | Time saved (us) |\n")
+        file.write("|---------|------|---------|-----------------|\n")
+        nogoods = data['children'][1]['result'].get('nogoods')
+        if not nogoods is None:
+            file.write(f"| {nogoods['learned']} | {nogoods['hits']} | {nogoods['evicted']} | {nogoods['time_saved_us']} |\n")
+        else:
+            file.write("| N/A | N/A | N/A | N/A |\n")
 
         file.write("### Jump heights\n")
         file.write("| Min | Max | Average | Median |\n")
@@ -0,0 +1,60 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: main() for dictionary compiler, which writes compiled images for word_dict to map
+// ==================================================================
+
+#include "../common/common_data_types.h"
+#include "../utils/cw_utils.h"
+#include "../word_dict/word_dict.h"
+#include "../lib/src/cxxopts.hpp"
+
+using namespace common_data_types_ns;
+using namespace cw;
+using namespace word_dict_ns;
+
+/**
+ * @brief main function using command line interface w/ cxxopts to compile dictionaries
+*/
+int main(int argc, char** argv) {
+    cxxopts::Options options("cw_dictc", "Compile .json/.txt word dictionaries into images that cw_gen maps at startup instead of parsing");
+
+    options.add_options()
+        ("i,input",    "Dictionary files to compile",                                        cxxopts::value<vector<string>>())
+        ("o,output",   "Output image path, only allowed with a single input (default: input path with .cwdict extension)", cxxopts::value<string>())
+        ("p,progress", "Enable progress bar",                                                cxxopts::value<bool>())
+        ("h,help",     "Print usage")
+        ;
+    options.parse_positional({"input"});
+    options.positional_help("<dictionary files>");
+
+    auto result = options.parse(argc, argv);
+
+    // print help msg if specified
+    if(result.count("help") || !result.count("input")) {
+        cout << options.help() << endl;
+        exit(result.count("help") ? 0 : 1);
+    }
+
+    const vector<string> inputs = result["input"].as<vector<string>>();
+    if(result.count("output") && inputs.size() != 1) {
+        cout << "Error: output path may only be specified with exactly one input dictionary" << endl;
+        exit(1);
+    }
+
+    for(const string& input : inputs) {
+        if(!std::filesystem::exists(input) || std::filesystem::path(input).extension() == DICT_IMAGE_EXTENSION) {
+            cout << "Error: got missing or already compiled input dictionary " << input << endl;
+            exit(1);
+        }
+
+        // always compile from source, so no existing image, at output or next to input, is ever reused as the source
+        const std::filesystem::path output = result.count("output") ? std::filesystem::path(result["output"].as<string>()) : word_dict::image_path(input);
+        word_dict dict("cw_dictc " + input, word_dict::read_words(input, result.count("progress") > 0));
+        dict.save_image(output);
+
+        cout << "Compiled " << dict.size() << " words from " << input << " into " << output.string() << endl;
+    }
+
+    return 0;
+}
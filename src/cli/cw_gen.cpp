@@ -40,9 +40,10 @@ string cw_gen::squash_options(const vector<string>& options) {
  */
 vector<string> cw_gen::solve() {
     crossword cw = crossword("puzzle cw", length, height, contents.value_or(string(num_tiles(), WILDCARD)));
-    tree = make_unique<cw_tree>("cw_tree", std::move(cw), dict_path.at(dict), display_progress_bar, trace_header);
+    dictionary = word_dict::load(dict_path.at(dict), display_progress_bar);
+    tree = make_unique<cw_tree>("cw_tree", std::move(cw), dictionary, display_progress_bar, trace_header);
 
-    return tree->solve(num_solutions, allow_permutations);
+    return tree->solve(num_solutions, allow_permutations, num_threads, seed, val_order, strategy);
 }
 
 /**
@@ -56,6 +57,8 @@ int main(int argc, char** argv) {
     unordered_map<string, vector<string> > param_vals = {
         {"dict", {"small", "medium", "large", "xlarge", "giant", "all"}},
         {"example", {"empty", "cross", "bridge", "stairs", "donut", "crosshair1", "crosshair2"}},
+        {"order", {"score", "lcv", "lcv_score"}},
+        {"algorithm", {"backtracking", "local_search", "lns"}},
         {"verbosity", {"fatal", "error", "warning", "info", "debug"}}
     };
 
@@ -72,6 +75,10 @@ int main(int argc, char** argv) {
         ("e,example",   examples_desc.str(),                                                         cxxopts::value<string>())
         ("n,num",       "Number of solutions to find",                                               cxxopts::value<size_t>()->default_value("1"))
         ("m,modify",    "Allow grid modifications upon domain exhaustion",                           cxxopts::value<bool>())
+        ("j,threads",   "Threads to search with, racing solvers or splitting each modified grid",    cxxopts::value<size_t>()->default_value("1"))
+        ("r,seed",      "Nonzero seed to search with randomized restarts, reproducible per seed",    cxxopts::value<uint64_t>())
+        ("o,order",     "Order to try words in: " + cw_gen::squash_options(param_vals["order"]),     cxxopts::value<string>()->default_value("score"))
+        ("a,algorithm", "Search algorithm: " + cw_gen::squash_options(param_vals["algorithm"]),      cxxopts::value<string>()->default_value("backtracking"))
         ("v,verbosity", "Debug verbosity: " + cw_gen::squash_options(param_vals["verbosity"]),       cxxopts::value<string>()->default_value("fatal"))
         ("p,progress",  "Enable progress bar",                                                       cxxopts::value<bool>())
         ("t,trace",     "Name of instrumentation file to generate by tracing execution if provided", cxxopts::value<string>())
@@ -165,6 +172,52 @@ int main(int argc, char** argv) {
         cwgen.enable_modify_grid();
     }
 
+    // ############### threads ###############
+
+    size_t num_threads = result["threads"].as<size_t>();
+    if(num_threads == 0) {
+        cout << "Error: got illegal number of threads: " << num_threads << ", must be nonzero" << endl;
+        exit(1);
+    }
+    cwgen.set_num_threads(num_threads);
+
+    // ############### seed ###############
+
+    if(result.count("seed")) {
+        uint64_t seed = result["seed"].as<uint64_t>();
+        if(seed == 0) {
+            cout << "Error: got illegal seed: " << seed << ", must be nonzero" << endl;
+            exit(1);
+        }
+        cwgen.set_seed(seed);
+    }
+
+    // ############### value ordering ###############
+
+    string order = result["order"].as<string>();
+    if(std::find(param_vals["order"].begin(), param_vals["order"].end(), order) == param_vals["order"].end()) {
+        cout << "Error: got invalid order option " << order << ", allowed: " << cw_gen::squash_options(param_vals["order"]) << endl;
+        exit(1);
+    }
+    cwgen.set_val_order(val_order_name_to_type.at(order));
+
+    // ############### algorithm ###############
+
+    string algorithm = result["algorithm"].as<string>();
+    if(std::find(param_vals["algorithm"].begin(), param_vals["algorithm"].end(), algorithm) == param_vals["algorithm"].end()) {
+        cout << "Error: got invalid algorithm option " << algorithm << ", allowed: " << cw_gen::squash_options(param_vals["algorithm"]) << endl;
+        exit(1);
+    }
+    if(algorithm == "local_search" && (num_threads > 1 || result.count("modify"))) {
+        cout << "Error: local search cannot prove a grid has no solution, so it only searches the initial grid with a single thread" << endl;
+        exit(1);
+    }
+    if(algorithm == "lns" && num_threads > 1) {
+        cout << "Error: lns searches with a single thread" << endl;
+        exit(1);
+    }
+    cwgen.set_strategy(strategy_name_to_type.at(algorithm));
+
     // ############### verbosity ###############
 
     string verbosity = result["verbosity"].as<string>();
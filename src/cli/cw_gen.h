@@ -12,6 +12,7 @@
 #include "../utils/cw_utils.h"
 #include "../crossword/crossword.h"
 #include "../cw_tree/cw_tree.h"
+#include "../word_dict/word_dict.h"
 #include "cw_gen_data_types.h"
 #include "../lib/src/cxxopts.hpp"
 
@@ -20,6 +21,7 @@ using namespace common_data_types_ns;
 using namespace cw;
 using namespace crossword_ns;
 using namespace cw_tree_ns;
+using namespace word_dict_ns;
 using namespace cw_gen_data_types_ns;
 
 namespace cw_gen_ns {
@@ -37,6 +39,10 @@ namespace cw_gen_ns {
             void set_dict           (const string& d) { dict = d;                             }
             void set_contents       (const string& c) { contents = std::make_optional(c);     }
             void set_num_solutions  (size_t n)        { num_solutions = n;                    }
+            void set_num_threads    (size_t n)        { num_threads = n;                      }
+            void set_seed           (uint64_t s)      { seed = std::make_optional(s);         }
+            void set_val_order      (val_ordering o)  { val_order = o;                        }
+            void set_strategy       (csp_solving_strategy s) { strategy = s;                  }
             void enable_modify_grid ()                { allow_permutations = true;            }
             void enable_progress_bar()                { display_progress_bar = true;          }
             void enable_trace       (const string& t) { trace_header = std::make_optional(t); }
@@ -61,12 +67,27 @@ namespace cw_gen_ns {
             // dictionary name
             string dict;
 
+            // dictionary contents, loaded once and shared with tree
+            shared_ptr<const word_dict> dictionary;
+
             // contents to populate crossword grid with
             optional<string> contents;
 
             // number of solutions to find
             size_t num_solutions;
 
+            // number of solvers to race on the grid
+            size_t num_threads = 1;
+
+            // seed of randomized tiebreaks to search with restarts, search without restarts iff this has no value
+            optional<uint64_t> seed;
+
+            // order candidate words are tried in
+            val_ordering val_order = HIGH_SCORE_AND_FREQ;
+
+            // algorithm to search the grid with
+            csp_solving_strategy strategy = BACKTRACKING;
+
             // whether to allow searching of grid permutations
             bool allow_permutations = false;
 
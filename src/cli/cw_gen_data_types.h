@@ -8,8 +8,10 @@
 #define CW_GEN_DATA_TYPES_H
 
 #include "../common/common_data_types.h"
+#include "../cw_csp/cw_csp_data_types.h"
 
 using namespace common_data_types_ns;
+using namespace cw_csp_data_types_ns;
 
 namespace cw_gen_data_types_ns {
 
@@ -22,6 +24,20 @@ namespace cw_gen_data_types_ns {
         {"debug", DEBUG},
     };
 
+    // mapping from value ordering name to value
+    unordered_map<string, val_ordering> val_order_name_to_type = {
+        {"score",     HIGH_SCORE_AND_FREQ},
+        {"lcv",       LCV},
+        {"lcv_score", LCV_SCORE},
+    };
+
+    // mapping from solving algorithm name to strategy
+    unordered_map<string, csp_solving_strategy> strategy_name_to_type = {
+        {"backtracking", BACKTRACKING},
+        {"local_search", LOCAL_SEARCH},
+        {"lns",          LNS},
+    };
+
     // map from dictionary name to path where it is located
     unordered_map<string, std::filesystem::path> dict_path = {
         {"small",   "src/data/data_small.json"},
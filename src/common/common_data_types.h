@@ -13,6 +13,7 @@
 #include <exception>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <stack>
 #include <tuple>
 #include <string>
@@ -24,13 +25,21 @@
 #include <array>
 #include <chrono>
 #include <mutex>
+#include <atomic>
+#include <random>
 #include <memory>
 #include <optional>
+#include <variant>
 #include <iomanip>
 #include <bitset>
 #include <functional>
 #include <numeric>
+#include <cmath>
 #include <filesystem>
+#include <bit>
+#include <span>
+#include <cstring>
+#include <algorithm>
 
 #include "../lib/src/json.hpp"
 
@@ -56,6 +65,7 @@ using std::stringstream;
 using std::string_view;
 using std::vector;
 using std::queue;
+using std::deque;
 using std::stack;
 using std::tuple;
 using std::ifstream;
@@ -85,6 +95,9 @@ using basic_json   = nlohmann::json;         // unordered json
 using ordered_json = nlohmann::ordered_json; // for ordering tracer output json fields for easier reading
 
 namespace common_data_types_ns {
+    // id of a word interned in a word_dict, dense in [0, size()) of that word_dict
+    using word_id_t = uint32_t;
+
     /**
      * @brief struct to represent possible cw words & extra heuristics for prioritization
     */
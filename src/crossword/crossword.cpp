@@ -249,6 +249,20 @@ void crossword::report_invalidating_tiles(vector<pair<uint, uint> >&& tiles) {
     }
 }
 
+/**
+ * @brief read how often a tile was reported to cause csp to become invalid
+ * 
+ * @param row target row
+ * @param col target column
+ * @return # of reports of tile since construction or reset()
+*/
+uint crossword::read_invalid_freq(uint row, uint col) const {
+    cw_assert(row < rows());
+    cw_assert(col < cols());
+
+    return invalid_freq[row][col];
+}
+
 /**
  * @brief resets all previous calls to write()
 */
@@ -46,9 +46,15 @@ namespace crossword_ns {
             // report tiles whose intersection(s) caused csp to become invalid
             void report_invalidating_tiles(vector<pair<uint, uint> >&& tiles);
 
+            // # of times a tile's intersection(s) caused csp to become invalid
+            uint read_invalid_freq(uint row, uint col) const;
+
             // undo all word writes
             void reset();
 
+            // returns clone of puzzle, i.e. copy of grid without progress
+            crossword clone() const;
+
             // returns all permutations of puzzle, i.e. copies of grid with additional black tile and without progress
             vector<crossword> permutations(unordered_set<string>& explored_grids) const;
 
@@ -94,9 +100,6 @@ namespace crossword_ns {
             char read_initial_at(uint row, uint col) const;
             char read_input_at(uint row, uint col) const;
 
-            // returns clone of puzzle, i.e. copy of grid without progress
-            crossword clone() const;
-
             // try to set a tile to black
             optional<permutation_score> permute(uint row, uint col, unordered_set<string>& explored_grids);
 
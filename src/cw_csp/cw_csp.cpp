@@ -6,6 +6,9 @@
 
 #include "cw_csp.h"
 
+#include <thread>
+#include <ctime>
+
 using namespace cw_csp_ns;
 
 /**
@@ -18,16 +21,66 @@ using namespace cw_csp_ns;
  * @param enable_tracer enables cw_tracer iff true
 */
 cw_csp::cw_csp(const string& name, crossword&& grid, const std::filesystem::path& dict_filepath, bool print_progress_bar, bool enable_tracer) 
+        : cw_csp(name, std::move(grid), word_dict::load(dict_filepath, print_progress_bar), print_progress_bar, enable_tracer) {
+    // do nothing, delegated to constructor does everything needed
+}
+
+/**
+ * @brief constructor for constraint satisfaction problem with a dictionary already loaded
+ * 
+ * @param name name of this object
+ * @param grid rvalue crossword grid to solve and assume ownership of, can have or not have contents
+ * @param dict shared dictionary of words to populate variable domains with
+ * @param print_progress_bar displays progress bar iff true
+ * @param enable_tracer enables cw_tracer iff true
+*/
+cw_csp::cw_csp(const string& name, crossword&& grid, shared_ptr<const word_dict> dict, bool print_progress_bar, bool enable_tracer) 
         : common_parent(name, VERBOSITY),
           tracer("cw_csp", enable_tracer),
-          dict_filepath(dict_filepath),
           enable_tracer(enable_tracer),
           cw(std::move(grid)),
-          total_domain(name + " total_domain", dict_filepath, print_progress_bar),
+          dict(std::move(dict)),
           print_progress_bar(print_progress_bar) {
+    cw_assert(this->dict);
     initialize_csp();
 }
 
+/**
+ * @brief constructor for a worker of a parallel search, copying the search state of another csp at the root of its search tree
+ *
+ * @param name name of this object
+ * @param other csp to copy variables, constraints, & search parameters of
+*/
+cw_csp::cw_csp(const string& name, const cw_csp& other)
+        : common_parent(name, VERBOSITY),
+          tracer("cw_csp", false),
+          enable_tracer(false),
+          cw(other.cw.clone()),
+          dict(other.dict),
+          variables(other.variables.clone()),
+          constr_dependencies(other.constr_dependencies),
+          propagators(other.propagators),
+          constraint_queue(other.constraint_queue),
+          alldiffs(other.alldiffs),
+          alldiff_of(other.alldiff_of),
+          alldiff_changed(other.alldiff_changed),
+          explanations(other.explanations),
+          explanation_trail(other.explanation_trail),
+          explanation_trail_marks(other.explanation_trail_marks),
+          assigned_levels(other.assigned_levels),
+          num_assigned(other.num_assigned),
+          constr_scopes(other.constr_scopes),
+          constr_weights(other.constr_weights),
+          var_heap(other.var_heap),
+          dom_wdeg(other.dom_wdeg),
+          print_progress_bar(false),
+          seed(other.seed),
+          rng(other.rng),
+          stop_flag(other.stop_flag),
+          num_threads(1) {
+    cw_assert(other.assignment_path.empty());
+}
+
 /**
  * @brief getter function for variables by value
  * 
@@ -48,8 +101,8 @@ unordered_set<unique_ptr<cw_variable> > cw_csp::get_variables() const {
 */
 unordered_set<unique_ptr<cw_constraint> > cw_csp::get_constraints() const {
     unordered_set<unique_ptr<cw_constraint> > result;
-    for(const unique_ptr<cw_constraint>& constr : constraints) {
-        result.insert(constr->clone());
+    for(size_t id = 0; id < propagators.size(); ++id) {
+        result.insert(constraint(id).clone());
     }
     return result;
 }
@@ -61,14 +114,30 @@ unordered_set<unique_ptr<cw_constraint> > cw_csp::get_constraints() const {
 */
 unordered_map<unique_ptr<cw_variable>, unordered_set<unique_ptr<cw_constraint> > > cw_csp::get_constr_dependencies() const {
     unordered_map<unique_ptr<cw_variable>, unordered_set<unique_ptr<cw_constraint> > > result;
-    for(const auto& pair : constr_dependencies) {
-        for(const size_t constr : pair.second) {
-            result[variables[pair.first]->clone()].insert(constraints[constr]->clone());
+    for(size_t var_id = 0; var_id < constr_dependencies.num_rows(); ++var_id) {
+        for(const size_t constr : constr_dependencies[var_id]) {
+            result[variables[var_id]->clone()].insert(constraint(constr).clone());
         }
     }
     return result;
 }
 
+/**
+ * @brief get candidates of a variable in the order a search would try them under an LCV ordering
+ *
+ * @param var id of variable
+ * @param val_order LCV or LCV_SCORE
+ * @return every word in the current domain of var, in order
+*/
+vector<string> cw_csp::get_lcv_order(size_t var, val_ordering val_order) {
+    vector<string> result;
+    lcv_candidates candidates = least_constraining_values(var, val_order);
+    while(const optional<word_id_t> word = candidates.next()) {
+        result.emplace_back(dict->get_str(word.value()));
+    }
+    return result;
+}
+
 /**
  * @brief save trace result from cw_tracer to instrumentation file
  *
@@ -81,7 +150,7 @@ void cw_csp::save_trace_result(const std::filesystem::path& filepath) const {
         {"grid", ordered_json::object({
             {"rows", cw.rows()},
             {"cols", cw.cols()},
-            {"dict", dict_filepath},
+            {"dict", dict->filepath()},
             {"contents", cw.init_contents()}
         })},
         {"track_ac3",
@@ -146,12 +215,12 @@ void cw_csp::initialize_csp() {
                     // single letters are not full words
                     if(cur_var_len >= MIN_WORD_LEN) {
                         // gather new var domain and record its size
-                        unordered_set<word_t> domain = total_domain.find_matches(word_pattern.str());
+                        vector<word_id_t> domain = dict->find_match_ids(word_pattern.str());
                         var_domain_sizes[variables.size()] = domain.size();
 
                         // save new variable
                         variables.push_back(make_unique<cw_variable>(
-                            variables.size(), cur_var_row, cur_var_col, cur_var_len, DOWN, word_pattern.str(), std::move(domain)
+                            variables.size(), cur_var_row, cur_var_col, cur_var_len, DOWN, word_pattern.str(), dict, std::move(domain)
                         ));
                     }
 
@@ -170,12 +239,12 @@ void cw_csp::initialize_csp() {
         // applicable if the last MIN_WORD_LEN+ spaces in a row are blank
         if(traversing_word && cur_var_len >= MIN_WORD_LEN) {
             // gather new var domain and record its size
-            unordered_set<word_t> domain = total_domain.find_matches(word_pattern.str());
+            vector<word_id_t> domain = dict->find_match_ids(word_pattern.str());
             var_domain_sizes[variables.size()] = domain.size();
 
             // save new variable
             variables.push_back(make_unique<cw_variable>(
-                variables.size(), cur_var_row, cur_var_col, cur_var_len, DOWN, word_pattern.str(), std::move(domain)
+                variables.size(), cur_var_row, cur_var_col, cur_var_len, DOWN, word_pattern.str(), dict, std::move(domain)
             ));
         }
     }
@@ -216,12 +285,12 @@ void cw_csp::initialize_csp() {
                     // single letters are not full words
                     if(cur_var_len >= MIN_WORD_LEN) {
                         // gather new var domain and record its size
-                        unordered_set<word_t> domain = total_domain.find_matches(word_pattern.str());
+                        vector<word_id_t> domain = dict->find_match_ids(word_pattern.str());
                         var_domain_sizes[variables.size()] = domain.size();
 
                         // save new variable
                         variables.push_back(make_unique<cw_variable>(
-                            variables.size(), cur_var_row, cur_var_col, cur_var_len, ACROSS, word_pattern.str(), std::move(domain)
+                            variables.size(), cur_var_row, cur_var_col, cur_var_len, ACROSS, word_pattern.str(), dict, std::move(domain)
                         ));
                     }
 
@@ -240,16 +309,19 @@ void cw_csp::initialize_csp() {
         // applicable if the last MIN_WORD_LEN+ spaces in a row are blank
         if(traversing_word && cur_var_len >= MIN_WORD_LEN) {
             // gather new var domain and record its size
-            unordered_set<word_t> domain = total_domain.find_matches(word_pattern.str());
+            vector<word_id_t> domain = dict->find_match_ids(word_pattern.str());
             var_domain_sizes[variables.size()] = domain.size();
 
             // save new variable
             variables.push_back(make_unique<cw_variable>(
-                variables.size(), cur_var_row, cur_var_col, cur_var_len, ACROSS, word_pattern.str(), std::move(domain)
+                variables.size(), cur_var_row, cur_var_col, cur_var_len, ACROSS, word_pattern.str(), dict, std::move(domain)
             ));
         }
     }
 
+    // constraints as built, each moved into propagators once all exist
+    id_obj_manager<cw_constraint> constraints;
+
     // helper table to build valid constraints
     // var_intersect_table[i][j] corresponds to cw[i][j] 
     vector<vector<cw_arc> > var_intersect_table(cw.rows(), vector<cw_arc>(cw.cols()));
@@ -308,9 +380,11 @@ void cw_csp::initialize_csp() {
     utils.log(DEBUG, "cw_csp building length 2 constr_dependencies");
 
     // build arc table to list out all dependencies for easy arc queueing in AC-3
+    // built up as sets while searching for cycles, then frozen into constr_dependencies
+    unordered_map<size_t, unordered_set<size_t> > constr_dependency_lists;
     for(size_t i = 0; i < constraints.size(); ++i) {
         for(size_t var : constraints[i]->dependencies()) {
-            constr_dependencies[var].insert(i);
+            constr_dependency_lists[var].insert(i);
         }
     }
 
@@ -326,7 +400,7 @@ void cw_csp::initialize_csp() {
     */
     unordered_set<rot_vector<size_t> > unique_cycles;
     std::function<void(vector<size_t>&, vector<size_t>&)> find_cycles;
-    find_cycles = [this, &find_cycles, &unique_cycles](vector<size_t>& prev_arcs, vector<size_t>& visited_vars) {
+    find_cycles = [&constraints, &find_cycles, &unique_cycles, &constr_dependency_lists](vector<size_t>& prev_arcs, vector<size_t>& visited_vars) {
         cw_assert(prev_arcs.size());
         cw_assert(prev_arcs.size() < cw_cycle::MAX_CYCLE_LEN);
         cw_assert(visited_vars.size());
@@ -339,7 +413,7 @@ void cw_csp::initialize_csp() {
         cw_assert(cur_arc);
         const size_t cur_var = cur_arc->lhs;
         
-        for(const size_t dep : constr_dependencies.at(cur_var)) {
+        for(const size_t dep : constr_dependency_lists.at(cur_var)) {
             // this messy casting also guaranteed to work for same reason as above
             const cw_constraint * const next_constr = constraints[dep].get();
             const cw_arc * const next_arc = dynamic_cast<const cw_arc* const>(next_constr);
@@ -393,8 +467,8 @@ void cw_csp::initialize_csp() {
     // add cycles starting with each variable
     for(const size_t id : variables.ids()) {
         // filter out edge case for variables that don't intersect with any others
-        if(constr_dependencies.count(id)) {
-            for(const size_t dep : constr_dependencies.at(id)) {
+        if(constr_dependency_lists.count(id)) {
+            for(const size_t dep : constr_dependency_lists.at(id)) {
                 const cw_constraint * const constr = constraints[dep].get();
                 const cw_arc * const arc = dynamic_cast<const cw_arc* const>(constr);
                 cw_assert(arc);
@@ -411,16 +485,63 @@ void cw_csp::initialize_csp() {
     // add dependencies of newly created arc constraints
     for(size_t i = num_arcs; i < constraints.size(); ++i) {
         for(size_t var : constraints[i]->dependencies()) {
-            constr_dependencies[var].insert(i);
+            constr_dependency_lists[var].insert(i);
+        }
+    }
+
+    // freeze dependencies now that all constraints exist, and size AC-3 queue to fit every constraint
+    constr_dependencies = csr_adjacency(constr_dependency_lists, variables.size());
+    constraint_queue = id_queue(constraints.size());
+
+    // every variable a constraint touches shares its weight under DOM_WDEG
+    unordered_map<size_t, unordered_set<size_t> > constr_scope_lists;
+    for(size_t i = 0; i < constraints.size(); ++i) {
+        for(size_t var : constraints[i]->dependencies()) {
+            constr_scope_lists[i].insert(var);
+        }
+        for(size_t var : constraints[i]->dependents()) {
+            constr_scope_lists[i].insert(var);
+        }
+    }
+    constr_scopes = csr_adjacency(constr_scope_lists, constraints.size());
+    constr_weights.assign(constraints.size(), 1ul);
+
+    // no domain has been pruned by an assignment yet
+    explanations.assign(variables.size(), level_set_t());
+    assigned_levels.assign(variables.size(), 0ul);
+
+    // no word may be assigned to 2 variables, which can only happen among variables of the same length
+    map<uint, vector<size_t> > vars_by_length;
+    for(const unique_ptr<cw_variable>& var : variables) {
+        vars_by_length[var->length].push_back(var->id);
+    }
+    alldiff_of.assign(variables.size(), 0ul);
+    for(auto& [length, group] : vars_by_length) {
+        for(size_t var : group) {
+            alldiff_of[var] = alldiffs.size();
+        }
+        alldiffs.emplace_back(std::move(group));
+    }
+    alldiff_changed.assign(alldiffs.size(), true);
+
+    // store constraints by value & type, which is the only copy kept, since constraints are never modified after this
+    propagators.reserve(constraints.size());
+    for(const unique_ptr<cw_constraint>& constr : constraints) {
+        if(const cw_arc* arc = dynamic_cast<const cw_arc*>(constr.get())) {
+            propagators.emplace_back(*arc);
+        } else {
+            const cw_cycle* cycle = dynamic_cast<const cw_cycle*>(constr.get());
+            cw_assert(cycle);
+            propagators.emplace_back(*cycle);
         }
     }
 
     // calculate all neighbor vars connected to each var by a constraint
     // map of var id -> set of ids of connected vars
     map<size_t, set<size_t> > var_deps;
-    for(const auto& [var_id, constr_dep] : constr_dependencies) {
-        for(size_t constr_id : constr_dep) {
-            cw_assert(constraints[constr_id]->dependencies().count(var_id));
+    for(size_t var_id : variables.ids()) {
+        for(size_t constr_id : constr_dependencies[var_id]) {
+            cw_assert(std::ranges::count(constraints[constr_id]->dependencies(), var_id));
             for(size_t dep_var_id : constraints[constr_id]->dependents()) {
                 if(dep_var_id != var_id) {
                     var_deps[var_id].insert(dep_var_id);
@@ -437,10 +558,11 @@ void cw_csp::initialize_csp() {
 
     // record constraint dependencies for debugging
     span.result()["constr_deps"] = ordered_json::object();
-    cw_assert(variables.size() >= constr_dependencies.size());
+    cw_assert(variables.size() == constr_dependencies.num_rows());
     for(size_t var_id : variables.ids()) {
-        if(constr_dependencies.count(var_id)) {
-            span.result()["constr_deps"][std::to_string(var_id)] = constr_dependencies.at(var_id);
+        const std::span<const size_t> constr_deps = constr_dependencies[var_id];
+        if(!constr_deps.empty()) {
+            span.result()["constr_deps"][std::to_string(var_id)] = vector<size_t>(constr_deps.begin(), constr_deps.end());
         }
     }
 
@@ -460,7 +582,8 @@ void cw_csp::initialize_csp() {
     // record dependent variables of each constraint
     span.result()["constr_dependent_vars"] = ordered_json::object();
     for(size_t id : constraints.ids()) {
-        span.result()["constr_dependent_vars"][std::to_string(id)] = constraints[id]->dependents();
+        const std::span<const size_t> dependents = constraints[id]->dependents();
+        span.result()["constr_dependent_vars"][std::to_string(id)] = vector<size_t>(dependents.begin(), dependents.end());
     }
 
     // record length of each variable
@@ -482,78 +605,172 @@ void cw_csp::initialize_csp() {
  * @return true iff resulting CSP is valid, i.e. all resulting variables have a non-empty domain
 */
 bool cw_csp::ac3() {
+    // constraint ids to be checked, initially all constraints
+    cw_assert(constraint_queue.empty());
+    for(size_t constr_id = 0; constr_id < propagators.size(); ++constr_id) {
+        constraint_queue.push(constr_id);
+    }
+
+    return run_ac3({});
+}
+
+/**
+ * @brief AC-3 algorithm to reduce CSP after some variable domains were reduced at a fixpoint of AC-3, e.g. by an assignment.
+ * only constraints with a changed variable as a dependency can have become inconsistent, so only those are initially checked
+ * 
+ * @param changed_vars ids of variables whose domains were reduced since AC-3 last ran to completion
+ * @return true iff resulting CSP is valid, i.e. all resulting variables have a non-empty domain
+*/
+bool cw_csp::ac3(std::span<const size_t> changed_vars) {
+    // constraint ids to be checked, initially those dependent on changed variables
+    cw_assert(constraint_queue.empty());
+    for(size_t var_id : changed_vars) {
+        for(size_t constr_id : constr_dependencies[var_id]) {
+            constraint_queue.push(constr_id);
+        }
+    }
+
+    return run_ac3(changed_vars);
+}
+
+/**
+ * @brief AC-3 algorithm to reduce CSP, stops early if CSP becomes invalid.
+ * starts from constraints already in constraint_queue, and always leaves it empty.
+ * words of changed variables that are assigned are first removed from all other variables of the same length, 
+ * and once pruning reaches a fixpoint, variables of each length are checked for Hall sets
+ * 
+ * @param changed_vars ids of variables whose domains were reduced since AC-3 last ran to completion
+ * @return true iff resulting CSP is valid, i.e. all resulting variables have a non-empty domain
+*/
+bool cw_csp::run_ac3(std::span<const size_t> changed_vars) {
     #ifdef TRACER_TRACK_AC3
     cw_trace_span_guard span(tracer, TS_CSP_AC3, "");
+    span.result()["num_seeded"] = constraint_queue.size();
     #endif // TRACER_TRACK_AC3
 
     utils.log(DEBUG, "starting AC-3 algorithm");
 
-    // constraint ids to be checked
-    queue<size_t> constraint_queue;
-
-    // for O(1) lookup of queue contents to avoid duplicate constraints in queue
-    // a constraint c's id is in constraints_in_queue iff c's id also in constraint_queue
-    unordered_set<size_t> constraints_in_queue;
-
     // notify var domains of new AC-3 call
     for(unique_ptr<cw_variable>& var : variables) {
         var->domain.start_new_ac3_call();
     }
+    explanation_trail_marks.push_back(explanation_trail.size());
 
-    // initialize constraint_queue
-    for(size_t constr_id : constraints.ids()) {
-        constraint_queue.push(constr_id);
-        constraints_in_queue.insert(constr_id);
+    // early stopping upon invalid CSP, once conflict is set
+    auto invalidate = [&]() {
+        constraint_queue.clear();
+        std::fill(alldiff_changed.begin(), alldiff_changed.end(), false);
+        #ifdef TRACER_TRACK_AC3
+        span.result()["success"] = false;
+        #endif // TRACER_TRACK_AC3
+        return false;
+    };
+
+    // remove words of newly assigned variables from other variables of the same length, explained by the assignment alone
+    for(size_t var_id : changed_vars) {
+        alldiff_changed[alldiff_of[var_id]] = true;
+        if(!variables[var_id]->domain.is_assigned()) {
+            continue;
+        }
+        pruned.clear();
+        alldiffs[alldiff_of[var_id]].prune_domain(variables, var_id, pruned);
+        if(backjumping()) {
+            const level_set_t cause = explanation_of(var_id);
+            for(const auto& [other, _] : pruned) {
+                explain(other, cause);
+            }
+        }
+        enqueue_pruned();
+
+        // a variable left with no words but the assigned one is now empty
+        for(const auto& [other, _] : pruned) {
+            if(variables[other]->domain.size() == 0) {
+                utils.log(DEBUG, "CSP became invalid");
+                conflict = explanations[other];
+                return invalidate();
+            }
+        }
     }
 
     // run AC-3 algo
     size_t constr_id;
     while(!constraint_queue.empty()) {
         // pop top constraint
-        constr_id = constraint_queue.front();
-        constraint_queue.pop();
-        cw_assert(constraints_in_queue.count(constr_id) > 0);
-        constraints_in_queue.erase(constr_id);
+        constr_id = constraint_queue.pop();
 
         // prune invalid words in domain, and if domain changed, add dependent constraints to constraint queue
-        unordered_map<size_t, size_t> modified;
+        // dispatched on the stored type of constraint, so each step is a direct call that reuses pruned instead of allocating
+        pruned.clear();
         {
             #ifdef TRACER_TRACK_AC3
             cw_trace_span_guard span(tracer, TS_CSP_AC3_PRUNE, std::to_string(constr_id));
             #endif
 
-            modified = constraints[constr_id]->prune_domain(variables);
+            std::visit([this](auto& constr) { constr.prune_domain(variables, pruned); }, propagators[constr_id]);
             #ifdef TRACER_TRACK_AC3
             span.result()["vars_pruned"] = ordered_json::object();
-            for(const auto& [var_id, pairs_removed] : modified) {
-                span.result()["vars_pruned"][std::to_string(var_id)] = pairs_removed;
+            for(const auto& [var_id, pairs_removed] : pruned) {
+                ordered_json& entry = span.result()["vars_pruned"][std::to_string(var_id)];
+                entry = (entry.is_null() ? 0ul : entry.get<size_t>()) + pairs_removed;
             }
             #endif
         }
-        if(modified.size() > 0) {
-            if(constraints[constr_id]->invalid(variables)) {
+        if(!pruned.empty()) {
+            // words were pruned because of the domains of this constraint's dependencies, so their explanations carry over
+            if(backjumping()) {
+                level_set_t cause;
+                for(size_t dep : std::visit([](const auto& constr) { return constr.dependencies(); }, propagators[constr_id])) {
+                    cause |= explanation_of(dep);
+                }
+                for(const auto& [var_id, _] : pruned) {
+                    explain(var_id, cause);
+                }
+            }
+
+            if(std::visit([this](const auto& constr) { return constr.invalid(variables); }, propagators[constr_id])) {
                 // CSP is now invalid, i.e. var has empty domain
                 utils.log(DEBUG, "CSP became invalid");
 
+                // the assignments that emptied the domain, together with those pruning what it was pruned by, are in conflict
+                conflict.reset();
+                for(size_t dep : std::visit([](const auto& constr) { return constr.dependents(); }, propagators[constr_id])) {
+                    conflict |= explanations[dep] | explanation_of(dep);
+                }
+
+                // weight constraint for wiping out a domain, making variables it touches more likely to be selected first
+                ++constr_weights[constr_id];
+                if(dom_wdeg) {
+                    for(size_t var : constr_scopes[constr_id]) {
+                        var_heap.add_wdeg(var, 1ul);
+                    }
+                }
+
                 // report violating tiles that caused this to become invalid to the crossword grid
-                cw.report_invalidating_tiles(constraints[constr_id]->intersection_tiles(variables));
+                cw.report_invalidating_tiles(constraint(constr_id).intersection_tiles(variables));
 
-                // early stopping upon invalid CSP
-                #ifdef TRACER_TRACK_AC3
-                span.result()["success"] = false;
-                #endif // TRACER_TRACK_AC3
-                return false;
+                return invalidate();
             }
 
-            // add dependent constraints to queue
-            for(const auto& [dep, _] : modified) {
-                for(size_t dep_constr : constr_dependencies.at(dep)) {
-                    if(constraints_in_queue.count(dep_constr) == 0) {
-                        constraint_queue.push(dep_constr);
-                        constraints_in_queue.insert(dep_constr);
-                    }
-                }
+            enqueue_pruned();
+        }
+    }
+
+    // words of a Hall set of variables can be assigned to none of the other variables of their length, but only
+    // Hall sets that leave some variable without a word are detected, so this checks the CSP rather than pruning it
+    // only groups with a domain changed by this call are checked, since no other group can have become violated
+    for(size_t i = 0; i < alldiffs.size(); ++i) {
+        const cw_alldiff& alldiff = alldiffs[i];
+        if(!alldiff_changed[i]) {
+            continue;
+        }
+        alldiff_changed[i] = false;
+        if(alldiff.var_group.size() <= MAX_HALL_CHECK_VARS && alldiff.hall_violated(variables, hall_buffers)) {
+            utils.log(DEBUG, "CSP became invalid");
+            conflict.reset();
+            for(size_t var_id : alldiff.var_group) {
+                conflict |= explanation_of(var_id);
             }
+            return invalidate();
         }
     }
 
@@ -564,6 +781,22 @@ bool cw_csp::ac3() {
     return true;
 }
 
+/**
+ * @brief add constraints depending on each variable in pruned to the AC-3 queue, as their domains have changed,
+ * & mark their all-different constraints to be checked for Hall sets
+*/
+void cw_csp::enqueue_pruned() {
+    for(const auto& [var_id, _] : pruned) {
+        alldiff_changed[alldiff_of[var_id]] = true;
+        for(size_t dep_constr : constr_dependencies[var_id]) {
+            constraint_queue.push(dep_constr);
+        }
+        if(dom_wdeg) {
+            var_heap.set_dom(var_id, variables[var_id]->domain.size());
+        }
+    }
+}
+
 /**
  * @brief undo domain pruning from previous call of AC-3 algorithm
 */
@@ -574,35 +807,78 @@ void cw_csp::undo_ac3() {
 
     for(unique_ptr<cw_variable>& var : variables) {
         var->domain.undo_prev_ac3_call();
+        if(dom_wdeg) {
+            var_heap.set_dom(var->id, var->domain.size());
+        }
+    }
+
+    // restore explanations replaced during the previous AC-3 call, latest first
+    cw_assert(!explanation_trail_marks.empty());
+    while(explanation_trail.size() > explanation_trail_marks.back()) {
+        explanations[explanation_trail.back().first] = explanation_trail.back().second;
+        explanation_trail.pop_back();
+    }
+    explanation_trail_marks.pop_back();
+}
+
+/**
+ * @brief get levels of assignments explaining the current domain of a variable, i.e. assignments that would alone
+ * reduce its domain the same way through propagation. an assigned variable's domain is explained by its assignment alone
+ *
+ * @param var id of variable
+ * @return set of levels explaining domain of var
+*/
+level_set_t cw_csp::explanation_of(size_t var) const {
+    if(variables[var]->domain.is_assigned()) {
+        level_set_t res;
+        res.set(assigned_levels[var]);
+        return res;
     }
+    return explanations[var];
 }
 
 /**
- * @brief checks if this CSP is solved, i.e. all variables have 1 value in domain & all constraints satisfied
+ * @brief add levels of assignments to the explanation of a variable's domain, saving the previous explanation to be
+ * restored when the current AC-3 call is undone
+ *
+ * @param var id of variable whose domain was pruned
+ * @param cause levels of assignments explaining why it was pruned
+*/
+void cw_csp::explain(size_t var, const level_set_t& cause) {
+    const level_set_t merged = explanations[var] | cause;
+    if(merged != explanations[var]) {
+        explanation_trail.emplace_back(var, explanations[var]);
+        explanations[var] = merged;
+    }
+}
+
+/**
+ * @brief checks if this CSP is solved, i.e. all variables have 1 value in domain & all constraints satisfied.
+ * verifies the whole CSP, so search only checks num_assigned, and this is checked once a search succeeds
  * 
  * @return true iff CSP is solved
 */
 bool cw_csp::solved() const {
-    unordered_set<word_t> used_words;
+    unordered_set<word_id_t> used_words;
+    used_words.reserve(variables.size());
 
     // check that all vars have one remaining domain value & satisfied
     for(const unique_ptr<cw_variable>& var : variables) {
         // check that all vars satisifed w/ one domain value
-        if(var->domain.size() != 1 || !var->domain.is_assigned()) {
+        const optional<word_id_t> value = var->domain.get_assigned_value();
+        if(!value.has_value()) {
             return false;
         }
 
         // check that domain value is unique
-        word_t domain_val = var->domain.get_cur_domain().at(0);
-        if(used_words.count(domain_val) > 0) {
+        if(!used_words.insert(value.value()).second) {
             return false;
         }
-        used_words.insert(domain_val);
     }
 
     // check that all constraints satisfied
-    for(const unique_ptr<cw_constraint>& constr : constraints) {
-        if(!constr->satisfied(variables)) {
+    for(const constraint_variant_t& propagator : propagators) {
+        if(!std::visit([this](const auto& constr) { return constr.satisfied(variables); }, propagator)) {
             return false;
         }
     }
@@ -628,21 +904,110 @@ size_t cw_csp::select_unassigned_var(var_ordering var_order) {
     size_t result = id_obj_manager<cw_variable>::INVALID_ID;
 
     switch(var_order) {
-        case MRV: {
+        case MRV:
+        case MRV_DEGREE: {
                 size_t min_num_values = UINT_MAX;
+                size_t max_degree = 0;
+                size_t num_ties = 0; // # of variables seen so far ranked equal to result, for seeded tiebreaks
                 for(unique_ptr<cw_variable>& var : variables) {
-                    // if this variable is unassigned AND has fewer remaining values in domain
-                    if(!var->domain.is_assigned() && var->domain.size() < min_num_values) {
+                    if(var->domain.is_assigned()) {
+                        continue;
+                    }
+
+                    // degree only ranks variables under MRV_DEGREE, otherwise all variables have degree 0
+                    size_t degree = 0;
+                    if(var_order == MRV_DEGREE) {
+                        degree = constr_dependencies[var->id].size();
+                    }
+
+                    // if this variable has fewer remaining values in domain, or as many & more constraints
+                    if(var->domain.size() < min_num_values || (var->domain.size() == min_num_values && degree > max_degree)) {
                         min_num_values = var->domain.size();
+                        max_degree = degree;
                         result = var->id;
+                        num_ties = 1;
+                    } else if(seed != 0 && var->domain.size() == min_num_values && degree == max_degree) {
+                        // reservoir sample so each tied variable is equally likely to be selected
+                        if(std::uniform_int_distribution<size_t>(0, num_ties++)(rng) == 0) {
+                            result = var->id;
+                        }
                     }
                 }
             } break;
+        case DOM_WDEG: {
+                // heap holds exactly the unassigned variables
+                cw_assert(dom_wdeg);
+                if(!var_heap.empty()) {
+                    result = var_heap.top();
+                }
+            } break;
     }
 
     return result;
 }
 
+/**
+ * @brief fill var_heap with all unassigned variables, weighting each by the constraints it is in, & keep it updated from now on
+*/
+void cw_csp::init_dom_wdeg() {
+    // break ties randomly iff seeded, otherwise by variable id
+    vector<uint64_t> tiebreaks(variables.size());
+    for(size_t id = 0; id < variables.size(); ++id) {
+        tiebreaks[id] = seed != 0 ? rng() : id;
+    }
+    var_heap = dom_wdeg_heap(std::move(tiebreaks));
+
+    for(size_t constr_id = 0; constr_id < constr_scopes.num_rows(); ++constr_id) {
+        for(size_t var : constr_scopes[constr_id]) {
+            var_heap.add_wdeg(var, constr_weights[constr_id]);
+        }
+    }
+    for(const unique_ptr<cw_variable>& var : variables) {
+        if(!var->domain.is_assigned()) {
+            var_heap.insert(var->id, var->domain.size());
+        }
+    }
+    dom_wdeg = true;
+}
+
+/**
+ * @brief assign a word to an unassigned variable
+ *
+ * @param a assignment to make
+ * @param level level of search tree the assignment is made at
+*/
+void cw_csp::assign(const csp_assignment& a, size_t level) {
+    variables[a.var]->domain.assign_domain(a.word);
+    assigned_levels[a.var] = level;
+    ++num_assigned;
+    if(dom_wdeg) {
+        var_heap.erase(a.var);
+    }
+}
+
+/**
+ * @brief undo an assignment made by assign(), after the AC-3 call following it has been undone
+ *
+ * @param a assignment to undo
+*/
+void cw_csp::unassign(const csp_assignment& a) {
+    variables[a.var]->domain.unassign_domain();
+    --num_assigned;
+    if(dom_wdeg) {
+        var_heap.insert(a.var, variables[a.var]->domain.size());
+    }
+}
+
+/**
+ * @brief seed random tiebreaks of variable & value orderings, must be called before solve()
+ *
+ * @param seed seed of random engine, 0 to break ties deterministically
+*/
+void cw_csp::set_seed(uint64_t seed) {
+    this->seed = seed;
+    rng.seed(seed);
+}
+
 /**
  * @brief solves this CSP using the given strategy
  * 
@@ -664,23 +1029,406 @@ bool cw_csp::solve(csp_solving_strategy csp_strategy, var_ordering var_order, va
         return false;
     }
 
+    // heap of unassigned variables starts from domains left after initial propagation
+    if(var_order == DOM_WDEG) {
+        init_dom_wdeg();
+    }
+
+    // record counters of nogoods learned during search, summed over workers of a parallel search
+    auto record_nogoods = [this, &span]() {
+        span.result()["nogoods"] = ordered_json::object({
+            {"learned",       nogoods.stats().learned},
+            {"hits",          nogoods.stats().hits},
+            {"evicted",       nogoods.stats().evicted},
+            {"time_saved_us", nogoods.stats().time_saved_us}
+        });
+    };
+
     switch(csp_strategy) {
         case BACKTRACKING: {
-                if(solve_backtracking(var_order, val_order, print_progress_bar, 0)) {
-                    span.result()["success"] = true;
-                    span.result()["reason"]  = "recursive";
-                    return true;
-                } else {
-                    span.result()["success"] = false;
-                    span.result()["reason"]  = "recursive";
-                    return false;
-                }
+                const bool success = solve_backtracking(var_order, val_order, print_progress_bar, 0);
+                cw_assert(!success || solved());
+                record_nogoods();
+                span.result()["success"] = success;
+                span.result()["reason"]  = "recursive";
+                return success;
+            } break;
+        case PARALLEL_BACKTRACKING: {
+                const bool success = solve_parallel(var_order, val_order);
+                record_nogoods();
+                span.result()["num_threads"] = num_threads;
+                span.result()["success"]     = success;
+                span.result()["reason"]      = "recursive";
+                return success;
+            } break;
+        case RESTARTS: {
+                size_t num_runs = 0;
+                const bool success = solve_restarts(var_order, val_order, num_runs);
+                cw_assert(!success || solved());
+                record_nogoods();
+                span.result()["num_runs"] = num_runs;
+                span.result()["success"]  = success;
+                span.result()["reason"]   = "recursive";
+                return success;
+            } break;
+        case LNS: {
+                size_t num_iters = 0;
+                const bool success = solve_lns(var_order, val_order, num_iters);
+                cw_assert(!success || solved());
+                record_nogoods();
+                span.result()["num_iters"] = num_iters;
+                span.result()["success"]   = success;
+                span.result()["reason"]    = "recursive";
+                return success;
+            } break;
+        case LOCAL_SEARCH: {
+                size_t num_steps = 0;
+                const bool success = solve_local_search(num_steps);
+                cw_assert(!success || solved());
+                span.result()["num_steps"] = num_steps;
+                span.result()["success"]   = success;
+                span.result()["reason"]    = success ? "local search" : "out of steps";
+                return success;
             } break;
     }
 
     return false;
 }
 
+/**
+ * @brief use backtracking to solve CSP, abandoning each run once it hits its budget of failures & restarting from the root.
+ * ties in orderings are broken randomly, so each run makes different early choices, while constraint weights & nogoods learned
+ * by earlier runs carry over. budgets grow by the Luby sequence, so some run eventually searches the whole tree & exhaustion
+ * is still proven
+ *
+ * @param var_order variable ordering to use to select next unassigned variable
+ * @param val_order value ordering to use to select next word value to try
+ * @param num_runs set to # of runs searched
+ * @return true iff successful
+*/
+bool cw_csp::solve_restarts(var_ordering var_order, val_ordering val_order, size_t& num_runs) {
+    cw_assert_m(seed != 0, "restarts must be seeded to search differently on each run");
+
+    for(num_runs = 1; ; ++num_runs) {
+        // reorder by constraint weights learned so far, with new random tiebreaks
+        if(var_order == DOM_WDEG && num_runs > 1) {
+            init_dom_wdeg();
+        }
+
+        failure_budget = RESTART_BASE_FAILURES * luby(num_runs);
+        num_failures   = 0;
+        const bool success = solve_backtracking(var_order, val_order, false, 0);
+        const bool out_of_budget = stopped();
+        failure_budget = 0;
+
+        // unless out of budget, search was cancelled, or solved or exhausted the whole tree
+        if(success || !out_of_budget || stopped()) {
+            return success;
+        }
+        cw_assert(assignment_path.empty() && num_assigned == 0);
+        utils.log(DEBUG, "restarting after ", num_failures, " failures");
+    }
+}
+
+/**
+ * @brief solve CSP by large neighbourhood search. each search keeps a partial fill fixed & backtracks over the remaining
+ * variables until it runs out of LNS_FAILURE_BUDGET failures. the deepest partial fill it reached is kept for the next search,
+ * except for a connected region of variables that is unassigned to be re-solved, alternately around the variable crossing the
+ * tiles that most often invalidated the CSP, & around a random one. a search that exhausts the remaining variables without
+ * running out of budget proves the fixed fill wrong, so its region is instead around the deepest fixed assignment in conflict.
+ * after LNS_MAX_ITERS searches, search falls back to backtracking from the root without a budget, keeping constraint weights &
+ * nogoods learned so far, so the CSP is still proven invalid if no solution exists
+ *
+ * @param var_order variable ordering to use to select next unassigned variable
+ * @param val_order value ordering to use to select next word value to try
+ * @param num_iters set to # of budgeted searches made
+ * @return true iff successful, otherwise every fixed assignment is undone, leaving the CSP & crossword as they were
+*/
+bool cw_csp::solve_lns(var_ordering var_order, val_ordering val_order, size_t& num_iters) {
+    vector<csp_assignment> fixed;
+    track_deepest = true;
+    for(num_iters = 1; num_iters <= LNS_MAX_ITERS; ++num_iters) {
+        // a subset of a consistent fill is consistent, so fixing it never invalidates the CSP
+        const bool consistent = replay(fixed);
+        cw_assert_m(consistent, "fixed fill is consistent");
+        if(var_order == DOM_WDEG) {
+            init_dom_wdeg();
+        }
+
+        deepest_path = fixed;
+        failure_budget = LNS_FAILURE_BUDGET;
+        num_failures   = 0;
+        const bool success = solve_backtracking(var_order, val_order, false, static_cast<uint>(fixed.size()));
+        const bool out_of_budget = stopped();
+        failure_budget = 0;
+
+        if(success) {
+            track_deepest = false;
+            return true;
+        }
+        rewind();
+
+        // exhaustion proves the CSP invalid if nothing was fixed, or if no fixed assignment was in conflict
+        if(stopped() || (!out_of_budget && (fixed.empty() || (backjumping() && conflict.none())))) {
+            track_deepest = false;
+            return false;
+        }
+
+        // unassign region from the deepest fill reached, so it is searched again with all other variables assigned so far fixed
+        // if the fixed fill was proven wrong, its extensions are too, so the region is unassigned from the fixed fill instead,
+        // which strictly shrinks as the region starts from one of its assignments
+        size_t start = std::uniform_int_distribution<size_t>(0, variables.size() - 1)(rng);
+        if(!out_of_budget) {
+            start = fixed[std::min(deepest_level(conflict).value_or(fixed.size() - 1), fixed.size() - 1)].var;
+        } else if(num_iters % 2 == 1) {
+            start = hottest_var();
+        }
+        const vector<size_t> region = lns_region(start);
+        const size_t depth = deepest_path.size();
+        const vector<csp_assignment> prev = out_of_budget ? std::move(deepest_path) : std::move(fixed);
+        fixed.clear();
+        for(const csp_assignment& a : prev) {
+            if(std::find(region.begin(), region.end(), a.var) == region.end()) {
+                fixed.push_back(a);
+            }
+        }
+        utils.log(DEBUG, "LNS search ", num_iters, " reached depth ", depth, ", keeping ", fixed.size());
+    }
+    track_deepest = false;
+    num_iters = LNS_MAX_ITERS;
+
+    // out of searches, so search the whole tree
+    if(var_order == DOM_WDEG) {
+        init_dom_wdeg();
+    }
+    return solve_backtracking(var_order, val_order, false, 0);
+}
+
+/**
+ * @brief find the variable whose tiles were most often reported to the crossword as invalidating the CSP
+ *
+ * @return id of hottest variable, ties broken randomly, or of a random variable if no tile was reported yet
+*/
+size_t cw_csp::hottest_var() {
+    size_t result = std::uniform_int_distribution<size_t>(0, variables.size() - 1)(rng);
+    uint hottest = 0;
+    size_t num_ties = 0;
+    for(const unique_ptr<cw_variable>& var : variables) {
+        uint heat = 0;
+        for(uint i = 0; i < var->length; ++i) {
+            heat = std::max(heat, cw.read_invalid_freq(var->origin_row + (var->dir == DOWN   ? i : 0u),
+                                                       var->origin_col + (var->dir == ACROSS ? i : 0u)));
+        }
+        if(heat > hottest) {
+            result = var->id;
+            hottest = heat;
+            num_ties = 1;
+        } else if(heat == hottest && heat > 0 && std::uniform_int_distribution<size_t>(0, num_ties++)(rng) == 0) {
+            result = var->id;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief pick a connected region of variables for LNS to unassign, growing breadth first through crossing variables
+ *
+ * @param start id of variable to grow region from
+ * @return ids of up to LNS_REGION_VARS variables in region, starting with start
+*/
+vector<size_t> cw_csp::lns_region(size_t start) const {
+    vector<size_t> region = {start};
+    for(size_t next = 0; next < region.size() && region.size() < LNS_REGION_VARS; ++next) {
+        for(size_t constr_id : constr_dependencies[region[next]]) {
+            const cw_arc* arc = std::get_if<cw_arc>(&propagators[constr_id]);
+            if(arc != nullptr && region.size() < LNS_REGION_VARS && std::find(region.begin(), region.end(), arc->lhs) == region.end()) {
+                region.push_back(arc->lhs);
+            }
+        }
+    }
+    return region;
+}
+
+/**
+ * @brief solve CSP by min-conflicts local search. every variable is first filled greedily, most constrained first, with the word
+ * left in its domain by AC-3 conflicting least with words filled so far. then the variable with the most conflicts is refilled with
+ * the word conflicting least, until no conflicts are left. words replaced are tabu for LOCAL_SEARCH_TABU_STEPS steps unless they
+ * reach a fill with fewer conflicts than any before, so search does not cycle, & random walk steps escape local minima.
+ * ties are broken randomly, reproducibly for the same seed. search is incomplete, so failure does not prove no solution exists
+ *
+ * @param num_steps set to # of steps searched after the initial fill
+ * @return true iff successful
+*/
+bool cw_csp::solve_local_search(size_t& num_steps) {
+    // candidates of each variable are the words left in its domain, in increasing rank, & tiles shared are read off arcs into it
+    vector<vector<word_id_t> > candidates(variables.size());
+    vector<vector<cw_crossing> > crossings(variables.size());
+    for(const unique_ptr<cw_variable>& var : variables) {
+        for(const word_id_t word : var->domain.get_cur_domain_ranked()) {
+            candidates[var->id].push_back(word);
+        }
+        for(size_t constr_id : constr_dependencies[var->id]) {
+            if(const cw_arc* arc = std::get_if<cw_arc>(&propagators[constr_id])) {
+                crossings[var->id].push_back({ .index = arc->rhs_index, .other = arc->lhs, .other_index = arc->lhs_index });
+            }
+        }
+    }
+    min_conflicts_fill fill(dict, std::move(crossings));
+
+    // greedy initial fill, ties broken by rank
+    vector<size_t> fill_order(variables.size());
+    std::iota(fill_order.begin(), fill_order.end(), 0ul);
+    std::stable_sort(fill_order.begin(), fill_order.end(), [&candidates](size_t lhs, size_t rhs) {
+        return candidates[lhs].size() < candidates[rhs].size();
+    });
+    for(size_t var : fill_order) {
+        cw_assert(!candidates[var].empty());
+        word_id_t best = candidates[var].front();
+        size_t best_cost = fill.cost(var, best);
+        for(const word_id_t word : candidates[var]) {
+            if(best_cost == 0) {
+                break;
+            }
+            const size_t cost = fill.cost(var, word);
+            if(cost < best_cost) {
+                best = word;
+                best_cost = cost;
+            }
+        }
+        fill.set_word(var, best);
+    }
+
+    // last LOCAL_SEARCH_TABU_STEPS words replaced in each variable, with the step each becomes allowed again, in a ring per variable
+    // a variable is replaced at most once per step, so a word is only overwritten once it is allowed again
+    struct tabu_entry {
+        word_id_t word;
+        size_t until;
+    };
+    vector<tabu_entry> tabu(variables.size() * LOCAL_SEARCH_TABU_STEPS, { .word = 0, .until = 0 });
+    vector<size_t> tabu_next(variables.size(), 0ul);
+    auto is_tabu = [&tabu, &num_steps](size_t var, word_id_t word) {
+        for(size_t i = var * LOCAL_SEARCH_TABU_STEPS; i < (var + 1) * LOCAL_SEARCH_TABU_STEPS; ++i) {
+            if(tabu[i].word == word && tabu[i].until > num_steps) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // fewest conflicts of any fill so far, which tabu words may be put back to beat
+    size_t best_total = fill.total_conflicts();
+
+    std::bernoulli_distribution walk(LOCAL_SEARCH_WALK_PROB);
+    for(num_steps = 0; fill.total_conflicts() > 0 && num_steps < LOCAL_SEARCH_MAX_STEPS && !stopped(); ++num_steps) {
+        // variable with the most conflicts, or any variable in conflict on a random walk step
+        const bool random_walk = walk(rng);
+        const size_t var = random_walk ? fill.any_conflicted(rng) : fill.most_conflicted(rng);
+        const word_id_t prev = fill.word_of(var).value();
+
+        // random candidate on a random walk step, otherwise the allowed candidate conflicting least
+        optional<word_id_t> next;
+        if(random_walk) {
+            next = candidates[var][std::uniform_int_distribution<size_t>(0, candidates[var].size() - 1)(rng)];
+        } else {
+            size_t best_cost = SIZE_MAX;
+            size_t num_ties = 0;
+            for(const word_id_t word : candidates[var]) {
+                if(word == prev) {
+                    continue;
+                }
+                const size_t cost = fill.cost(var, word);
+                if(cost > best_cost) {
+                    continue;
+                }
+
+                // tabu words are allowed iff they reach a fill with fewer conflicts than any before
+                if(fill.total_conflicts() + cost >= best_total + fill.conflicts_of(var) && is_tabu(var, word)) {
+                    continue;
+                }
+
+                if(cost < best_cost) {
+                    next = word;
+                    best_cost = cost;
+                    num_ties = 1;
+                } else if(std::uniform_int_distribution<size_t>(0, num_ties++)(rng) == 0) {
+                    next = word;
+                }
+            }
+        }
+
+        // variable has no other allowed candidate
+        if(!next.has_value() || next.value() == prev) {
+            continue;
+        }
+
+        tabu[var * LOCAL_SEARCH_TABU_STEPS + tabu_next[var]] = { .word = prev, .until = num_steps + LOCAL_SEARCH_TABU_STEPS };
+        tabu_next[var] = (tabu_next[var] + 1) % LOCAL_SEARCH_TABU_STEPS;
+        fill.set_word(var, next.value());
+        best_total = std::min(best_total, fill.total_conflicts());
+    }
+
+    if(fill.total_conflicts() > 0) {
+        utils.log(DEBUG, "local search stopped after ", num_steps, " steps with ", fill.total_conflicts(), " conflicts left");
+        return false;
+    }
+
+    // assign solution like a search would, so the CSP & crossword are left solved
+    vector<csp_assignment> solution;
+    for(size_t id = 0; id < variables.size(); ++id) {
+        solution.push_back({ .var = id, .word = fill.word_of(id).value() });
+    }
+    const bool consistent = replay(solution);
+    cw_assert_m(consistent, "fill without conflicts is consistent");
+    return true;
+}
+
+/**
+ * @brief key all candidates of a variable by how many words they would leave in the domains of the unassigned variables
+ * crossing it, i.e. the product of the # of words with the candidate's letter at each intersection, without running AC-3.
+ * letter counts are read once per intersection, so keying costs O(# of intersections * letters + domain size * # of intersections),
+ * and candidates are only sorted as far as search tries them
+ *
+ * @param var id of unassigned variable whose candidates to rank
+ * @param val_order LCV, or LCV_SCORE to also weight each candidate by its word score
+ * @return all words in domain of var, to be tried most words left first, tiebroken by rank in dict, or randomly if seeded
+*/
+lcv_candidates cw_csp::least_constraining_values(size_t var, val_ordering val_order) {
+    cw_assert(val_order == LCV || val_order == LCV_SCORE);
+
+    // log2 of # of words each letter would leave at each intersection with an unassigned variable, indexed by letter
+    // intersections with assigned variables leave every candidate the same single word, so they do not rank candidates
+    vector<pair<uint, array<double, NUM_ENGLISH_LETTERS> > > crossings;
+    for(size_t constr_id : constr_dependencies[var]) {
+        const cw_arc* arc = std::get_if<cw_arc>(&propagators[constr_id]);
+        if(arc == nullptr || variables[arc->lhs]->domain.is_assigned()) {
+            continue;
+        }
+        array<double, NUM_ENGLISH_LETTERS> left;
+        for(size_t letter = 0; letter < NUM_ENGLISH_LETTERS; ++letter) {
+            left[letter] = std::log2(static_cast<double>(variables[arc->lhs]->domain.num_letters_at_index(arc->lhs_index, static_cast<char>('a' + letter))));
+        }
+        crossings.emplace_back(arc->rhs_index, left);
+    }
+
+    // key in log space so products of large domains cannot overflow, candidates wiping out a crossing are tried last at -inf
+    // domain is generated in increasing rank, so its position breaks ties by rank unless seeded
+    lcv_candidates result;
+    result.reserve(variables[var]->domain.size());
+    uint64_t position = 0;
+    for(const word_id_t word : variables[var]->domain.get_cur_domain_ranked()) {
+        const string_view str = dict->get_str(word);
+        double key = 0.0;
+        for(const auto& [index, left] : crossings) {
+            key += left[static_cast<size_t>(str[index] - 'a')];
+        }
+        if(val_order == LCV_SCORE) {
+            key += std::log2(static_cast<double>(std::max(dict->get_score(word), 0) + 1));
+        }
+        result.push(key, seed != 0 ? rng() : position++, word);
+    }
+    return result;
+}
+
 /**
  * @brief use backtracking strategy to solve CSP
  *
@@ -696,8 +1444,13 @@ bool cw_csp::solve_backtracking(var_ordering var_order, val_ordering val_order,
 
     utils.log(DEBUG, "entering solve_backtracking() with depth ", depth);
 
-    // base case
-    if(solved()) {
+    // deepest partial fill so far is kept for LNS to start its next search from
+    if(track_deepest && assignment_path.size() > deepest_path.size()) {
+        deepest_path = assignment_path;
+    }
+
+    // base case, every assignment was propagated by AC-3 without invalidating the CSP, so all constraints are satisfied
+    if(num_assigned == variables.size()) {
         span.result()["variable"]    = nullptr;
         span.result()["success"]     = true;
         span.result()["reason"]      = "solved";
@@ -705,24 +1458,33 @@ bool cw_csp::solve_backtracking(var_ordering var_order, val_ordering val_order,
         return true;
     }
 
+    // level of the assignment made by this search step
+    const size_t level = assignment_path.size();
+    const time_point<high_resolution_clock> start = high_resolution_clock::now();
+    cw_assert(level == depth);
+
+    // search abandoned from elsewhere
+    if(stopped()) {
+        set_chronological_conflict(level);
+        span.result()["variable"]    = nullptr;
+        span.result()["success"]     = false;
+        span.result()["reason"]      = "cancelled";
+        span.result()["jump_height"] = nullptr;
+        return false;
+    }
+
     // select next variable
     size_t next_var = select_unassigned_var(var_order);
     cw_assert(next_var != id_obj_manager<cw_variable>::INVALID_ID);
 
     utils.log(DEBUG, "selected next var: ", *variables[next_var]);
     
-    // get domain of next variable as list of candidates to try to assign
-    vector<word_t> domain_copy{variables[next_var]->domain.get_cur_domain()};
-
-    // sort candidates by word score, tiebroken by frequency
-    // TODO: implement other strategies
-    cw_assert_m(val_order == HIGH_SCORE_AND_FREQ, "Value orderings other than HIGH_SCORE_AND_FREQ not currently supported by solve_backtracking()");
-    auto compare = [](const word_t& lhs, const word_t& rhs) {
-        if(lhs.score != rhs.score) return lhs.score > rhs.score;
-        if(lhs.freq != rhs.freq) return lhs.freq > rhs.freq;
-        return lhs.word > rhs.word;
-    };
-    sort(domain_copy.begin(), domain_copy.end(), compare);
+    // under HIGH_SCORE_AND_FREQ, candidates are tried by word score, tiebroken by frequency, then by word, i.e. in increasing rank in dict
+    // generated lazily from the domain of next variable, so candidates after a successful one are never visited
+    // if seeded, each run of candidates with equal score & frequency is instead tried in a random order
+    // under LCV orderings, all candidates are instead keyed up front by least_constraining_values(), & sorted as they are tried
+    cw_assert(&variables[next_var]->domain.get_table() == dict.get());
+    const size_t domain_size = variables[next_var]->domain.size();
 
     // record variable chosen
     span.result()["variable"] = ordered_json::object({
@@ -731,37 +1493,103 @@ bool cw_csp::solve_backtracking(var_ordering var_order, val_ordering val_order,
         {"direction",   word_dir_name.at(variables[next_var]->dir)},
         {"length",      variables[next_var]->length},
         {"id",          next_var},
-        {"domain_size", domain_copy.size()}
+        {"domain_size", domain_size}
     });
 
     // only initialize if this is top level solve_backtracking() call in prod
     unique_ptr<progress_bar> bar = nullptr;
     if(do_progress_bar) {
-        bar = make_unique<progress_bar>(utils, domain_copy.size(), 0.01, PROGRESS_BAR_WIDTH, "Searching", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
+        bar = make_unique<progress_bar>(utils, domain_size, 0.01, PROGRESS_BAR_WIDTH, "Searching", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
+    }
+
+    // generator of candidates in the order they are tried
+    word_domain::ranked_domain candidates = variables[next_var]->domain.get_cur_domain_ranked();
+    word_domain::ranked_domain::iterator it = candidates.begin();
+    vector<word_id_t> ties; // current run of equally ranked candidates if seeded
+    size_t next_tie = 0ul;
+    lcv_candidates lcv;     // all candidates under LCV orderings
+    if(val_order != HIGH_SCORE_AND_FREQ) {
+        lcv = least_constraining_values(next_var, val_order);
     }
+    auto next_candidate = [&]() -> optional<word_id_t> {
+        if(val_order != HIGH_SCORE_AND_FREQ) {
+            return lcv.next();
+        }
+        if(seed == 0) {
+            if(it == candidates.end()) {
+                return std::nullopt;
+            }
+            const word_id_t word = *it;
+            ++it;
+            return word;
+        }
+
+        // pull the next run of ties once the current one is exhausted
+        if(next_tie == ties.size()) {
+            ties.clear();
+            next_tie = 0ul;
+            for(; it != candidates.end(); ++it) {
+                if(!ties.empty() && (dict->get_score(*it) != dict->get_score(ties.front()) || dict->get_freq(*it) != dict->get_freq(ties.front()))) {
+                    break;
+                }
+                ties.push_back(*it);
+            }
+            std::shuffle(ties.begin(), ties.end(), rng);
+        }
+        if(next_tie == ties.size()) {
+            return std::nullopt;
+        }
+        return ties[next_tie++];
+    };
+
+    // levels of shallower assignments explaining why candidates tried so far failed, for conflict-directed backjumping
+    // if a candidate fails for reasons not involving this level, no other candidate can succeed, so search jumps straight
+    // back to the deepest level responsible, past any search steps in between
+    level_set_t conflicts;
+    bool backjumped = false;
+    bool donated    = false; // some candidates are searched by other workers, so their conflicts are not known here
 
     // iterate through search space for this variable
-    for(word_t word : domain_copy) {
+    while(const optional<word_id_t> candidate = next_candidate()) {
+        // search abandoned from elsewhere, stop trying candidates
+        if(stopped()) {
+            break;
+        }
+
+        // split untried candidates off into subtrees for idle workers of a parallel search, oldest subtrees are stolen first
+        if(pool != nullptr && pool->hungry()) {
+            while(const optional<word_id_t> untried = next_candidate()) {
+                vector<csp_assignment> subtree = assignment_path;
+                subtree.push_back({ .var = next_var, .word = untried.value() });
+                pool->push(worker, std::move(subtree));
+                donated = true;
+            }
+        }
+
+        const word_id_t word = candidate.value();
         cw_trace_span_guard word_span(tracer, TS_CSP_TRY_ASSIGN, "");
-        word_span.result()["word"] = word.word;
+        word_span.result()["word"] = dict->get_str(word);
 
-        // avoid duplicate words
-        if(assigned_words.count(word) == 0) {
+        // avoid words completing a nogood, i.e. known to fail alongside assignments already made
+        // words already assigned are never candidates, since AC-3 removes them from all other variables of the same length
+        const csp_assignment assignment = { .var = next_var, .word = word };
+        const vector<csp_assignment>* nogood = nogoods.find(assignment, [this](const csp_assignment& a) { return holds(a); });
+        if(nogood == nullptr) {
             // assignment
-            variables[next_var]->domain.assign_domain(word);
-            assigned_words.insert(word);
+            assign(assignment, level);
 
-            utils.log(DEBUG, "trying new word: ", word);
+            utils.log(DEBUG, "trying new word: ", dict->get_str(word));
 
             // if does not result in invalid CSP, recurse
-            if(ac3()) {
-                utils.log(DEBUG, "adding new word: ", word, " to var: ", *variables[next_var]);
+            const time_point<high_resolution_clock> ac3_start = high_resolution_clock::now();
+            if(ac3(std::span<const size_t>(&next_var, 1))) {
+                utils.log(DEBUG, "adding new word: ", dict->get_str(word), " to var: ", *variables[next_var]);
 
                 // add to crossword assignment
                 cw.write({
                     .origin_row = variables[next_var]->origin_row,
                     .origin_col = variables[next_var]->origin_col,
-                    .word       = word.word,
+                    .word       = string(dict->get_str(word)),
                     .dir        = variables[next_var]->dir
                 });
 
@@ -770,46 +1598,274 @@ bool cw_csp::solve_backtracking(var_ordering var_order, val_ordering val_order,
                 word_span.result()["reason"]  = "recursive";
 
                 // recurse
+                assignment_path.push_back(assignment);
                 if(solve_backtracking(var_order, val_order, false, depth + 1)) {
                     span.result()["success"]     = true;
                     span.result()["reason"]      = "recursive";
                     span.result()["jump_height"] = nullptr;
                     return true;
                 }
+                assignment_path.pop_back();
                 
                 // undo adding to crossword asignment
-                cw_assert(cw.undo_prev_write() == word.word);
+                cw_assert(cw.undo_prev_write() == dict->get_str(word));
+
+                // jump back past this level iff it is not responsible for the failure below
+                if(backjumping() && !conflict.test(level)) {
+                    backjumped = true;
+                } else {
+                    conflicts |= conflict;
+                }
 
                 word_span.result()["success"] = false;
                 word_span.result()["reason"]  = "recursive";
             } else {
+                conflicts |= conflict;
+                learn_nogood(conflict, assignment, ac3_start);
+                ++num_failures;
+
                 word_span.result()["success"] = false;
                 word_span.result()["reason"]  = "ac3";
             }
             undo_ac3(); // undo AC-3 regardless of if CSP invalid or failed recursively
 
-            utils.log(DEBUG, "word failed: ", word);
+            utils.log(DEBUG, "word failed: ", dict->get_str(word));
 
             // undo assignment
-            variables[next_var]->domain.unassign_domain();
-            assigned_words.erase(word);
+            unassign(assignment);
         } else {
+            // word fails because of the assignments it would complete the nogood with
+            for(const csp_assignment& a : *nogood) {
+                if(a.var != next_var) {
+                    conflicts.set(assigned_levels[a.var]);
+                }
+            }
+
+            ++num_failures;
+
             word_span.result()["success"] = false;
-            word_span.result()["reason"]  = "duplicate";
-            utils.log(DEBUG, "avoided duplicate word: ", word);
+            word_span.result()["reason"]  = "nogood";
+            utils.log(DEBUG, "avoided nogood word: ", dict->get_str(word));
         }
 
         // another word searched
         if(bar) bar->incr_numerator();
+
+        // conflict of the failed candidate is left for the level responsible for it
+        if(backjumped) {
+            span.result()["success"]     = false;
+            span.result()["reason"]      = "backjumped";
+            span.result()["jump_height"] = nullptr;
+            return false;
+        }
+    }
+
+    // candidates not tried here may not have failed, otherwise the domain was exhausted because of the conflicts of
+    // every candidate tried, and of the assignments that pruned the rest from the domain
+    if(donated || stopped() || !backjumping()) {
+        set_chronological_conflict(level);
+    } else {
+        conflict = conflicts | explanations[next_var];
+        conflict.reset(level);
+        learn_nogood(conflict, std::nullopt, start);
     }
 
+    // # of search steps jumped back, i.e. to the search step of the deepest level in conflict, otherwise out of the search
+    const size_t jump_height = std::max(level - deepest_level(conflict).value_or(0ul), 1ul);
+
     // after returning here or if solution, progress bar goes out of scope and finishes printing in destructor
     span.result()["success"]     = false;
-    span.result()["reason"]      = "domain exhausted";
-    span.result()["jump_height"] = 1; // upon failure, backtracking always goes up only one search step
+    span.result()["reason"]      = stopped() ? "cancelled" : "domain exhausted";
+    span.result()["jump_height"] = jump_height;
+    return false;
+}
+
+/**
+ * @brief check if an assignment currently holds
+ *
+ * @param a assignment of a word to a variable
+ * @return true iff variable of a is assigned the word of a
+*/
+bool cw_csp::holds(const csp_assignment& a) const {
+    return variables[a.var]->domain.is_assigned() && assignment_path[assigned_levels[a.var]].word == a.word;
+}
+
+/**
+ * @brief learn a nogood of the assignments at levels in a conflict, so search never tries them together again
+ *
+ * @param levels levels of assignments in conflict, those not yet in assignment_path are ignored
+ * @param assignment assignment in conflict not yet in assignment_path, if any
+ * @param start time the conflict started being proved at
+*/
+void cw_csp::learn_nogood(const level_set_t& levels, const optional<csp_assignment>& assignment, time_point<high_resolution_clock> start) {
+    if(!backjumping() || levels.count() > MAX_NOGOOD_SIZE) {
+        return;
+    }
+
+    vector<csp_assignment> nogood;
+    for(size_t l = 0; l < assignment_path.size(); ++l) {
+        if(levels.test(l)) {
+            nogood.push_back(assignment_path[l]);
+        }
+    }
+    if(assignment.has_value()) {
+        nogood.push_back(assignment.value());
+    }
+
+    const uint64_t cost_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(high_resolution_clock::now() - start).count());
+    nogoods.learn(std::move(nogood), cost_us);
+}
+
+/**
+ * @brief explain a failure of a search step by every shallower assignment, so search only backtracks one level from it
+ *
+ * @param level level of the assignment made by the failed search step
+*/
+void cw_csp::set_chronological_conflict(size_t level) {
+    conflict.reset();
+    for(size_t l = 0; l < level && l < conflict.size(); ++l) {
+        conflict.set(l);
+    }
+}
+
+/**
+ * @brief use backtracking strategy to solve CSP with num_threads workers, each searching its own copy of this CSP.
+ * the whole search tree starts with one worker, which splits its untried candidates off as subtrees whenever another worker is idle
+ *
+ * @param var_order variable ordering to use to select next unassigned variable
+ * @param val_order value ordering to use to select next word value to try
+ * @return true iff successful, in which case this CSP holds the solution found
+*/
+bool cw_csp::solve_parallel(var_ordering var_order, val_ordering val_order) {
+    cw_assert(assignment_path.empty());
+
+    // search the whole tree, i.e. the subtree with no assignments
+    subtree_pool subtrees(num_threads);
+    subtrees.push(0ul, vector<csp_assignment>());
+
+    // set once a worker finds a solution
+    shared_ptr<std::atomic<bool> > found = make_shared<std::atomic<bool> >(false);
+    optional<vector<csp_assignment> > solution;
+    mutex solution_mx;
+
+    vector<unique_ptr<cw_csp> > workers;
+    for(size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(new cw_csp(name + " worker " + std::to_string(i), *this));
+        workers[i]->set_stop_flag(found);
+        workers[i]->pool   = &subtrees;
+        workers[i]->worker = i;
+    }
+
+    auto search = [&](size_t idx) {
+        optional<vector<csp_assignment> > res = workers[idx]->search_subtrees(var_order, val_order);
+        if(res.has_value()) {
+            lock_guard<mutex> lock(solution_mx);
+            if(!solution.has_value()) {
+                solution = std::move(res);
+            }
+            found->store(true); // stop all other workers
+        }
+    };
+
+    vector<std::thread> threads;
+    for(size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back(search, i);
+    }
+    for(std::thread& t : threads) {
+        t.join();
+    }
+    for(const unique_ptr<cw_csp>& w : workers) {
+        nogoods.add_stats(w->nogoods.stats());
+    }
+
+    // bring this CSP to the solution found
+    if(solution.has_value()) {
+        const bool valid = replay(solution.value());
+        cw_assert(valid && solved());
+        return true;
+    }
     return false;
 }
 
+/**
+ * @brief as a worker of a parallel search, backtrack over subtrees from the pool until a solution is found or none remain
+ *
+ * @param var_order variable ordering to use to select next unassigned variable
+ * @param val_order value ordering to use to select next word value to try
+ * @return assignments from root of search tree to solution, if found by this worker
+*/
+optional<vector<csp_assignment> > cw_csp::search_subtrees(var_ordering var_order, val_ordering val_order) {
+    cw_assert(pool != nullptr && stop_flag != nullptr);
+
+    // cpu time of this thread alone, so the share of work of each worker is known however threads are scheduled
+    auto thread_cpu_ms = []() {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+    };
+    const double start_ms = thread_cpu_ms();
+    size_t num_subtrees = 0;
+    auto log_work = [&]() {
+        utils.log(INFO, "worker ", worker, " searched ", num_subtrees, " subtrees with ", num_failures, " failures in ", thread_cpu_ms() - start_ms, "ms of cpu time");
+    };
+
+    while(optional<vector<csp_assignment> > subtree = pool->take(worker, *stop_flag)) {
+        ++num_subtrees;
+        if(replay(subtree.value()) && solve_backtracking(var_order, val_order, false, static_cast<uint>(assignment_path.size()))) {
+            log_work();
+            return assignment_path;
+        }
+
+        rewind();
+        pool->finish();
+    }
+
+    log_work();
+    return std::nullopt;
+}
+
+/**
+ * @brief make assignments in order, propagating each with AC-3, as solve_backtracking() would when descending the search tree
+ *
+ * @param assignments words to assign
+ * @return true iff all assignments made without invalidating CSP, otherwise all assignments that were valid are kept
+*/
+bool cw_csp::replay(const vector<csp_assignment>& assignments) {
+    for(const csp_assignment& a : assignments) {
+        assign(a, assignment_path.size());
+
+        if(!ac3(std::span<const size_t>(&a.var, 1))) {
+            undo_ac3();
+            unassign(a);
+            return false;
+        }
+
+        cw.write({
+            .origin_row = variables[a.var]->origin_row,
+            .origin_col = variables[a.var]->origin_col,
+            .word       = string(dict->get_str(a.word)),
+            .dir        = variables[a.var]->dir
+        });
+        assignment_path.push_back(a);
+    }
+
+    return true;
+}
+
+/**
+ * @brief undo all assignments made while descending the search tree, returning to its root
+*/
+void cw_csp::rewind() {
+    while(!assignment_path.empty()) {
+        const csp_assignment a = assignment_path.back();
+        assignment_path.pop_back();
+
+        cw_assert(cw.undo_prev_write() == dict->get_str(a.word));
+        undo_ac3();
+        unassign(a);
+    }
+}
+
 /**
  * @brief get all permutations of this csp with a permutated crossword grid
  *
@@ -820,7 +1876,7 @@ vector<cw_csp> cw_csp::permutations(unordered_set<string>& explored_grids) const
     vector<cw_csp> res;
 
     for(size_t i = 0; i < p.size(); ++i) {
-        res.emplace_back(cw_csp(name + '-' + std::to_string(i), std::move(p[i]), dict_filepath, print_progress_bar, enable_tracer));
+        res.emplace_back(cw_csp(name + '-' + std::to_string(i), std::move(p[i]), dict, print_progress_bar, enable_tracer));
     }
 
     return res;
@@ -16,6 +16,7 @@
 #include "../cw_tracer/cw_tracer.h"
 #include "../word_domain/word_domain_data_types.h"
 #include "../word_domain/word_domain.h"
+#include "../word_dict/word_dict.h"
 
 using namespace cw_csp_data_types_ns;
 using namespace common_parent_ns;
@@ -26,6 +27,7 @@ using namespace cw_tracer_data_types_ns;
 using namespace cw_tracer_ns;
 using namespace word_domain_data_types_ns;
 using namespace word_domain_ns;
+using namespace word_dict_ns;
 
 namespace cw_csp_ns {
     /**
@@ -36,10 +38,26 @@ namespace cw_csp_ns {
             // base constructor, agnostic to grid layout
             cw_csp(const string& name, crossword&& grid, const std::filesystem::path& dict_filepath, bool print_progress_bar, bool enable_tracer);
 
+            // constructor with already loaded dictionary, agnostic to grid layout
+            cw_csp(const string& name, crossword&& grid, shared_ptr<const word_dict> dict, bool print_progress_bar, bool enable_tracer);
+
             // read-only getters for testing
             unordered_set<unique_ptr<cw_variable > >                                           get_variables()           const;
             unordered_set<unique_ptr<cw_constraint> >                                          get_constraints()         const;
             unordered_map<unique_ptr<cw_variable>, unordered_set<unique_ptr<cw_constraint> > > get_constr_dependencies() const;
+            string                                                                             get_grid()                const { return cw.serialize_result(); }
+
+            // candidate words of var in the order a search would try them under an LCV ordering, for testing
+            vector<string> get_lcv_order(size_t var, val_ordering val_order);
+
+            // break ties in variable & value orderings with a random engine seeded with seed, 0 for deterministic ties, nonzero under RESTARTS
+            void set_seed(uint64_t seed);
+
+            // abandon search as soon as flag is set, e.g. by another solver in a portfolio
+            void set_stop_flag(shared_ptr<const std::atomic<bool> > flag) { stop_flag = std::move(flag); }
+
+            // number of threads to search with under PARALLEL_BACKTRACKING
+            void set_num_threads(size_t n) { cw_assert(n > 0); num_threads = n; }
 
             // solve CSP
             bool solve(csp_solving_strategy csp_strategy, var_ordering var_order, val_ordering val_order);
@@ -47,6 +65,9 @@ namespace cw_csp_ns {
             // execute AC-3 algorithm to reduce CSP
             bool ac3();
 
+            // execute AC-3 algorithm from a fixpoint, where only domains of changed_vars have since been reduced
+            bool ac3(std::span<const size_t> changed_vars);
+
             // undo previous call of ac3() due to invalid CSP or backtracking
             void undo_ac3();
 
@@ -74,46 +95,184 @@ namespace cw_csp_ns {
             ~cw_csp() = default;
         
         protected:
+            // copy of current search state of other for a worker of a parallel search, without tracer or progress bar
+            cw_csp(const string& name, const cw_csp& other);
+
             // helper func to populate variables & constraints
             void initialize_csp();
 
+            // constraint with id, viewed through its base class for callers off the AC-3 path
+            const cw_constraint& constraint(size_t id) const {
+                return std::visit([](const auto& constr) -> const cw_constraint& { return constr; }, propagators[id]);
+            }
+
+            // AC-3 algorithm starting from constraints already in queue, & from words of changed variables if assigned
+            bool run_ac3(std::span<const size_t> changed_vars);
+
+            // add constraints depending on variables in pruned to queue, mark their alldiffs changed, & update their domain sizes in var_heap
+            void enqueue_pruned();
+
             // select next unassigned variable to explore
             size_t select_unassigned_var(var_ordering strategy);
 
+            // candidates of var keyed by val_order, for LCV orderings, sorted lazily as they are tried
+            lcv_candidates least_constraining_values(size_t var, val_ordering val_order);
+
             // use backtracking to solve CSP
             bool solve_backtracking(var_ordering var_order, val_ordering val_order, bool do_progress_bar, uint depth);
 
+            // use backtracking to solve CSP, restarting with randomized tiebreaks each time a run exceeds its failure budget
+            bool solve_restarts(var_ordering var_order, val_ordering val_order, size_t& num_runs);
+
+            // repair a complete fill by min-conflicts local search until no conflicts are left or out of steps
+            bool solve_local_search(size_t& num_steps);
+
+            // keep the deepest partial fill found by budgeted backtracking, & re-solve regions of it around hot tiles until solved
+            bool solve_lns(var_ordering var_order, val_ordering val_order, size_t& num_iters);
+
+            // variable crossing the tile that most often invalidated the CSP, or a random variable if none did
+            size_t hottest_var();
+
+            // connected region of up to LNS_REGION_VARS variables around start
+            vector<size_t> lns_region(size_t start) const;
+
+            // use backtracking to solve CSP, splitting search tree among num_threads workers
+            bool solve_parallel(var_ordering var_order, val_ordering val_order);
+
+            // as a worker of a parallel search, search subtrees from pool until one is solved or none remain
+            optional<vector<csp_assignment> > search_subtrees(var_ordering var_order, val_ordering val_order);
+
+            // assign words & propagate along path from current search state, false iff CSP becomes invalid
+            bool replay(const vector<csp_assignment>& assignments);
+
+            // undo all assignments in assignment_path
+            void rewind();
+
+            // true iff search was cancelled through stop flag, or its run of RESTARTS is out of budget
+            bool stopped() const {
+                return (stop_flag && stop_flag->load(std::memory_order_relaxed)) || (failure_budget != 0 && num_failures >= failure_budget);
+            }
+
+            // true iff search is shallow enough for its levels to be tracked for conflict-directed backjumping
+            bool backjumping() const { return variables.size() <= MAX_BACKJUMP_LEVELS; }
+
+            // levels of assignments explaining the current domain of var
+            level_set_t explanation_of(size_t var) const;
+
+            // add cause to explanation of var's domain, to be restored by undo_ac3()
+            void explain(size_t var, const level_set_t& cause);
+
+            // set conflict to all levels shallower than level, to backtrack chronologically
+            void set_chronological_conflict(size_t level);
+
+            // assign word to variable at level, & undo it once AC-3 following it is undone
+            void assign(const csp_assignment& a, size_t level);
+            void unassign(const csp_assignment& a);
+
+            // start DOM_WDEG ordering from the current domains & constraint weights
+            void init_dom_wdeg();
+
+            // true iff assignment is currently made
+            bool holds(const csp_assignment& a) const;
+
+            // store assignments at levels, & assignment if any, as a nogood that took since start to prove
+            void learn_nogood(const level_set_t& levels, const optional<csp_assignment>& assignment, time_point<high_resolution_clock> start);
+
         private:
             // tracer object for analysis
             mutable cw_tracer tracer;
 
-            // original word dictionary filepath
-            std::filesystem::path dict_filepath;
-
             // original tracer enabling input param
             bool enable_tracer;
 
             // crossword to be solved
             crossword cw;
 
-            // domain of all valid words of all lengths, to populate variable domains
-            word_domain total_domain;
+            // dictionary of all valid words of all lengths to populate variable domains, shared with permutations
+            shared_ptr<const word_dict> dict;
 
             // csp structures
-            id_obj_manager<cw_variable>   variables;
-            id_obj_manager<cw_constraint> constraints;
+            id_obj_manager<cw_variable> variables;
 
             // constr_dependencies[id of var_i] contains all ids of constraints with var_i as a dependency
             // i.e. arcs of the form (var_k, var_i) and all cycles containing var_i
             // when a constraint is updated, constr_dependencies of all its dependents must be reevaluated
-            unordered_map<size_t, unordered_set<size_t> > constr_dependencies;
+            csr_adjacency constr_dependencies;
+
+            // propagators[id] is the constraint with id, stored by value & type so AC-3 makes no virtual calls
+            vector<constraint_variant_t> propagators;
+
+            // scratch buffer of variables pruned by the current AC-3 step
+            pruned_vars_t pruned;
+
+            // constraints left to check in the current AC-3 call, empty between calls
+            id_queue constraint_queue;
+
+            // alldiffs[alldiff_of[id]] is the all-different constraint over variable id & all other variables of its length
+            vector<cw_alldiff> alldiffs;
+            vector<size_t> alldiff_of;
+
+            // alldiff_changed[i] iff a domain of a variable of alldiffs[i] changed since its last check for Hall sets,
+            // which can only become violated when a domain shrinks
+            vector<bool> alldiff_changed;
+            hall_scratch hall_buffers;
+
+            // explanations[id] contains levels of all assignments that caused AC-3 to prune the domain of variable id
+            // explanation_trail holds explanations replaced by each AC-3 call, starting from explanation_trail_marks, for undo_ac3()
+            vector<level_set_t> explanations;
+            vector<pair<size_t, level_set_t> > explanation_trail;
+            vector<size_t> explanation_trail_marks;
+
+            // assigned_levels[id] is the level at which variable id was assigned, iff it is assigned
+            vector<size_t> assigned_levels;
 
-            // words already assigned to the crossword, used to avoid duplicates
-            unordered_set<word_t> assigned_words;
+            // # of variables currently assigned, once all are assigned with AC-3 consistent the CSP is solved
+            size_t num_assigned = 0;
+
+            // levels of assignments explaining the last failure of AC-3 or solve_backtracking(), used to backjump to the deepest one
+            level_set_t conflict;
+
+            // constr_scopes[id of constr] contains ids of all variables constraint constr depends on or prunes
+            csr_adjacency constr_scopes;
+
+            // constr_weights[id] is 1 + # of times constraint id wiped out a domain in AC-3, weighting it under DOM_WDEG
+            vector<size_t> constr_weights;
+
+            // unassigned variables by domain size over weighted degree, maintained only while dom_wdeg is set
+            dom_wdeg_heap var_heap;
+            bool dom_wdeg = false;
+
+            // nogoods learned from conflicts, each checked before trying a candidate that would complete it
+            nogood_store nogoods{NOGOOD_STORE_CAPACITY, MAX_NOGOOD_SIZE};
 
             // progress bar for searching and domain building
             bool print_progress_bar;
 
+            // ties in variable & value orderings broken with rng iff nonzero, otherwise broken deterministically
+            uint64_t seed = 0;
+            std::mt19937_64 rng;
+
+            // search abandoned once this is set, if present
+            shared_ptr<const std::atomic<bool> > stop_flag;
+
+            // # of failures, i.e. candidates rejected by AC-3 or a nogood, the current run of RESTARTS may hit, 0 if unlimited
+            size_t failure_budget = 0;
+            size_t num_failures   = 0;
+
+            // # of workers for PARALLEL_BACKTRACKING
+            size_t num_threads = 1;
+
+            // assignments made by search from the root of the search tree, in order
+            vector<csp_assignment> assignment_path;
+
+            // longest assignment_path reached by search, recorded iff track_deepest is set
+            vector<csp_assignment> deepest_path;
+            bool track_deepest = false;
+
+            // pool to split open subtrees into & id within it, iff this is a worker of a parallel search
+            subtree_pool* pool = nullptr;
+            size_t worker = 0;
+
     }; // cw_csp
 } // cw_csp_ns
 
@@ -6,6 +6,8 @@
 
 #include "cw_csp_data_types.h"
 
+#include <thread>
+
 using namespace cw_csp_data_types_ns;
 
 // ############### cw_variable ###############
@@ -43,8 +45,8 @@ ostream& cw_csp_data_types_ns::operator<<(ostream& os, const cw_variable& var) {
     os << "cw_variable(row: " << var.origin_row << ", col: " << var.origin_col << ", len: " << var.length
        << ", dir: " << crossword_data_types_ns::word_dir_name.at(var.dir) << ", pattern: " 
        << var.pattern << ", domain: {";
-    for(word_t w : var.domain.get_cur_domain()) {
-        os << w.word << ", ";
+    for(const word_id_t id : var.domain.get_cur_domain_ids()) {
+        os << var.domain.get_table().get_str(id) << ", ";
     }
     os << "})";
     return os;
@@ -90,16 +92,17 @@ cw_variable& cw_variable::operator=(const cw_variable& other) {
  * @param length num of letters in this var
  * @param dir direction of this var
  * @param pattern word pattern to find matches for to populate domain
- * @param domain contents of domain of this var
+ * @param dict dictionary shared by all variables that domain ids refer to
+ * @param domain ids in dict of contents of domain of this var
 */
-cw_variable::cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, string pattern, unordered_set<word_t>&& domain) 
+cw_variable::cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, string pattern, shared_ptr<const word_dict> dict, vector<word_id_t>&& domain) 
     : id(id),
       origin_row(origin_row),
       origin_col(origin_col),
       length(length),
       dir(dir),
       pattern(pattern),
-      domain("cw_variable domain", std::move(domain)) {
+      domain("cw_variable domain", std::move(dict), std::move(domain)) {
     // do nothing else
 }
 
@@ -114,8 +117,14 @@ cw_variable::cw_variable(size_t id, uint origin_row, uint origin_col, uint lengt
  * @param domain contents of domain of this var
 */
 cw_variable::cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, unordered_set<word_t>&& domain) 
-    : cw_variable(id, origin_row, origin_col, length, dir, "(created w/ testing constructor)", std::move(domain)) {
-    // do nothing, delegated to constructor that does everything needed
+    : id(id),
+      origin_row(origin_row),
+      origin_col(origin_col),
+      length(length),
+      dir(dir),
+      pattern("(created w/ testing constructor)"),
+      domain("cw_variable domain", std::move(domain)) {
+    // do nothing else
 }
 
 // ############### cw_constraint ###############
@@ -197,26 +206,22 @@ cw_arc::cw_arc(size_t id, uint lhs_index, uint rhs_index, size_t lhs, size_t rhs
 /**
  * @brief AC-3 step to prune words in lhs domain without valid rhs words
  * 
- * @param  vars ref to id_obj_manager to index into to get lhs/rhs vars
- * @return map of all (var whose domain changed -> nonzero number of letter/index pairs removed)
-*/
-unordered_map<size_t, size_t> cw_arc::prune_domain(id_obj_manager<cw_variable>& vars) {
-    unordered_map<size_t, size_t> result;
-
-    letter_bitset_t lhs_letters = vars[lhs]->domain.get_all_letters_at_index(lhs_index);
-    letter_bitset_t rhs_letters = vars[rhs]->domain.get_all_letters_at_index(rhs_index);
-    for(uint i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
-        if(lhs_letters[i] && !rhs_letters[i]) {
-            // cannot satisfy constraint for this letter
-            const size_t num_words_removed = vars[lhs]->domain.remove_matching_words(lhs_index, static_cast<char>(i + 'a'));
-            cw_assert(num_words_removed);
-
-            // one additional letter/index pair removed, distinct from # of words removed
-            ++result[lhs];
-        }
+ * @param vars ref to id_obj_manager to index into to get lhs/rhs vars
+ * @param pruned appended with (var whose domain changed, nonzero number of letter/index pairs removed)
+*/
+void cw_arc::prune_domain(id_obj_manager<cw_variable>& vars, pruned_vars_t& pruned) {
+    const letter_bitset_t lhs_letters = vars[lhs]->domain.get_all_letters_at_index(lhs_index);
+    const letter_bitset_t rhs_letters = vars[rhs]->domain.get_all_letters_at_index(rhs_index);
+
+    // cannot satisfy constraint for these letters, remove them all at once
+    const letter_bitset_t unsupported = lhs_letters & ~rhs_letters;
+    if(unsupported.any()) {
+        const size_t num_words_removed = vars[lhs]->domain.remove_matching_words(lhs_index, unsupported);
+        cw_assert(num_words_removed);
+
+        // one letter/index pair removed per letter, distinct from # of words removed
+        pruned.emplace_back(lhs, unsupported.count());
     }
-
-    return result;
 }
 
 /**
@@ -230,8 +235,9 @@ bool cw_arc::satisfied(const id_obj_manager<cw_variable>& vars) const {
     if(vars[rhs]->domain.size() != 1) return false;
 
     // since ac3() undoes invalid assignments, this should always be true
-    const string lhs_word = vars[lhs]->domain.get_cur_domain().at(0).word;
-    const string rhs_word = vars[rhs]->domain.get_cur_domain().at(0).word;
+    // the only remaining words are read in place, without copying either domain
+    const string_view lhs_word = vars[lhs]->domain.get_table().get_str(*vars[lhs]->domain.get_cur_domain_ranked().begin());
+    const string_view rhs_word = vars[rhs]->domain.get_table().get_str(*vars[rhs]->domain.get_cur_domain_ranked().begin());
     cw_assert_m(lhs_word != rhs_word, "word equality between constrainted vars");
     cw_assert_m(lhs_word.at(lhs_index) == rhs_word.at(rhs_index), "letter inequality at constraint");
 
@@ -251,17 +257,17 @@ bool cw_arc::invalid(const id_obj_manager<cw_variable>& vars) const {
 /**
  * @brief get ids of variables upon which this constraint is dependent 
 */
-unordered_set<size_t> cw_arc::dependencies() const {
+std::span<const size_t> cw_arc::dependencies() const {
     cw_assert(rhs != id_obj_manager<cw_variable>::INVALID_ID);
-    return {rhs};
+    return std::span<const size_t>(&rhs, 1ul);
 }
 
 /**
  * @brief get id of variable upon which other constraints may be dependent
 */
-unordered_set<size_t> cw_arc::dependents() const {
+std::span<const size_t> cw_arc::dependents() const {
     cw_assert(lhs != id_obj_manager<cw_variable>::INVALID_ID);
-    return {lhs};
+    return std::span<const size_t>(&lhs, 1ul);
 }
 
 /**
@@ -424,26 +430,27 @@ cw_cycle::cw_cycle(size_t id, const vector<size_t>& var_cycle, const vector<pair
 /**
  * @brief AC-N step to prune words in first var domain without cyclical path back to first var
  * 
- * @param  vars ref to id_obj_manager to index into to get vars from
- * @return map of all (var whose domain changed -> nonzero number of letter/index pairs removed)
+ * @param vars ref to id_obj_manager to index into to get vars from
+ * @param pruned appended with (var whose domain changed, nonzero number of letter/index pairs removed) per intersection pruned
 */
-unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>& vars) {
+void cw_cycle::prune_domain(id_obj_manager<cw_variable>& vars, pruned_vars_t& pruned) {
     // imagine a graph with N layers, with each layer having up to 26 nodes
     // each layer is placed *in between* two variables that intersect
     // a node exists if the corresponding letter can be placed in the intersection 
     // an edge exists from a node to another node in the next layer iff allowed by has_letters_at_index_with_letter_assigned()
+    // all per layer state is held in fixed size arrays, so pruning does not allocate
 
     // letter_nodes[i] represents nodes between var_cycle[i] and var_cycle[(i+1) % N]
     // letter_nodes[i][j] set ==> letter j can be placed between variables var_cycle[i] and var_cycle[(i+1) % N]
-    vector<letter_bitset_t> letter_nodes(cycle_len);
+    cycle_layers_t letter_nodes{};
 
     // letter_edges[i] represents edges between nodes in letter_nodes[i] and letter_nodes[(i+1) % N]
     // letter_edges[i][j][k] set ==> edges exists from letter j node in var_cycle[i], and letter k node in var_cycle[(i+1) % N]
-    vector<array<letter_bitset_t, NUM_ENGLISH_LETTERS> > letter_edges(cycle_len);
+    array<array<letter_bitset_t, NUM_ENGLISH_LETTERS>, MAX_CYCLE_LEN> letter_edges{};
 
     // letter_in_cycle[i] represents letters placed between variables var_cycle[i] and var_cycle[(i+1) % N] that are part of a cycle
     // letter_in_cycle[i][j] set && letter_nodes[i][j] set ==> letter j between variables var_cycle[i] and var_cycle[(i+1) % N] is part of a cycle
-    vector<letter_bitset_t> letter_in_cycle(cycle_len);
+    cycle_layers_t letter_in_cycle{};
 
     // populate letter_nodes
     for(size_t i = 0; i < cycle_len; ++i) {
@@ -482,14 +489,14 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
      * @param idx index of the cycle origin node
      * @param letter letter of the cycle origin node 
      * 
-     * @return bitmap vector of length cycle_len representing all nodes in a cycle_len cycle that contains the node specified by idx/letter
+     * @return bitmaps of first cycle_len layers representing all nodes in a cycle_len cycle that contains the node specified by idx/letter
      */
-    auto get_nodes_of_cycles_containing = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> vector<letter_bitset_t> {
+    auto get_nodes_of_cycles_containing = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> cycle_layers_t {
         /**
          * @brief finds all nodes reachable using forward edges from this node in cycle_len-1 steps
         */
-        auto traverse_forward = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> vector<letter_bitset_t> {
-            vector<letter_bitset_t> reachable(cycle_len);
+        auto traverse_forward = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> cycle_layers_t {
+            cycle_layers_t reachable{};
             letter_bitset_t curr = letter_bitset_t(1 << letter);
             reachable[idx] = curr; // define current node as reachable
 
@@ -520,8 +527,8 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
         /**
          * @brief finds all nodes reachable using reverse edges from this node in cycle_len-1 steps
         */
-        auto traverse_reverse = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> vector<letter_bitset_t> {
-            vector<letter_bitset_t> reachable(cycle_len);
+        auto traverse_reverse = [this, &letter_nodes, &letter_edges](const size_t idx, const size_t letter) -> cycle_layers_t {
+            cycle_layers_t reachable{};
             letter_bitset_t curr = letter_bitset_t(1 << letter);
             reachable[idx] = curr; // define current node as reachable
 
@@ -546,17 +553,14 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
             return reachable;
         };
         
-        vector<letter_bitset_t> reachable_forward = traverse_forward(idx, letter);
-        vector<letter_bitset_t> reachable_reverse = traverse_reverse(idx, letter);
-
-        assert(reachable_forward.size() == cycle_len);
-        assert(reachable_reverse.size() == cycle_len);
+        const cycle_layers_t reachable_forward = traverse_forward(idx, letter);
+        const cycle_layers_t reachable_reverse = traverse_reverse(idx, letter);
 
         // all nodes reachable in both directions
         // on the layer of idx, we must have that only have the root letter node is reachable
         // all other layers must all be empty or all be nonempty
         // if they are all nonempty, then all nodes in reachable are part of a cycle_len cycle containing the target node
-        vector<letter_bitset_t> reachable(cycle_len);
+        cycle_layers_t reachable{};
 
         // populate reachable
         for(size_t i = 0; i < cycle_len; ++i) {
@@ -582,7 +586,7 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
         }
 
         // all relevant reachable layers are empty, thus no cycles containing the target node exist
-        return vector<letter_bitset_t>(cycle_len);
+        return cycle_layers_t{};
     };
 
     // populate letter_in_cycle
@@ -594,8 +598,7 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
         // explore node for j on root layer only if node exists
         if(letter_nodes[root_layer][j]) {
             // get nodes in cycles with exact length CYCLE_LEN that contain node j on first layer
-            vector<letter_bitset_t> nodes_in_cycle = get_nodes_of_cycles_containing(root_layer, j);
-            cw_assert(nodes_in_cycle.size() == cycle_len);
+            const cycle_layers_t nodes_in_cycle = get_nodes_of_cycles_containing(root_layer, j);
             
             // add to letter_in_cycle which contains all cycle nodes
             for(size_t i = 0; i < cycle_len; ++i) {
@@ -605,33 +608,37 @@ unordered_map<size_t, size_t> cw_cycle::prune_domain(id_obj_manager<cw_variable>
     }
 
     // remove letters from domains if node not part of a cycle
-    unordered_map<size_t, size_t> modified;
+    const size_t num_pruned_before = pruned.size();
+    auto pruned_by_this = [&pruned, num_pruned_before](size_t var) -> bool {
+        return std::any_of(pruned.begin() + static_cast<ptrdiff_t>(num_pruned_before), pruned.end(), [var](const pair<size_t, size_t>& p) { return p.first == var; });
+    };
     for(size_t i = 0; i < cycle_len; ++i) {
-        for(size_t j = 0; j < NUM_ENGLISH_LETTERS; ++j) {
-            // remove if node exists AND not part of a cycle
-            if(letter_nodes[i][j] && !letter_in_cycle[i][j]) {
-                const size_t lhs_idx = i;
-                const size_t rhs_idx = (i + 1) % cycle_len;
-
-                const size_t lhs_removed_words = vars[var_cycle[lhs_idx]]->domain.remove_matching_words(
-                    intersections[i].first,  static_cast<char>(j + 'a')
-                );
-                const size_t rhs_removed_words = vars[var_cycle[rhs_idx]]->domain.remove_matching_words(
-                    intersections[i].second, static_cast<char>(j + 'a')
-                );
-
-                // it's possible that previous letter/index pair removals on different intersection indices from both vars caused all
-                // matching words to already be removed from both vars, hence the last check if this is the case
-                cw_assert(lhs_removed_words || rhs_removed_words || (modified.count(var_cycle[lhs_idx]) && modified.count(var_cycle[rhs_idx])));
-
-                // don't report a letter/index pair as removed if no word matching that pair were removed
-                if(lhs_removed_words) ++modified[var_cycle[lhs_idx]];
-                if(rhs_removed_words) ++modified[var_cycle[rhs_idx]];
-            }
-        }
+        // remove if node exists AND not part of a cycle, all letters of an intersection at once
+        const letter_bitset_t unsupported = letter_nodes[i] & ~letter_in_cycle[i];
+        if(unsupported.none()) continue;
+
+        const size_t lhs_idx = i;
+        const size_t rhs_idx = (i + 1) % cycle_len;
+        word_domain& lhs_domain = vars[var_cycle[lhs_idx]]->domain;
+        word_domain& rhs_domain = vars[var_cycle[rhs_idx]]->domain;
+
+        // previous letter/index pair removals on different intersection indices may have already removed all words matching some of
+        // these pairs, so only pairs with matching words left are reported as removed
+        const size_t lhs_removed_pairs = (lhs_domain.get_all_letters_at_index(intersections[i].first)  & unsupported).count();
+        const size_t rhs_removed_pairs = (rhs_domain.get_all_letters_at_index(intersections[i].second) & unsupported).count();
+
+        const size_t lhs_removed_words = lhs_domain.remove_matching_words(intersections[i].first,  unsupported);
+        const size_t rhs_removed_words = rhs_domain.remove_matching_words(intersections[i].second, unsupported);
+
+        // it's possible that previous letter/index pair removals on different intersection indices from both vars caused all
+        // matching words to already be removed from both vars, hence the last check if this is the case
+        cw_assert(lhs_removed_words || rhs_removed_words || (pruned_by_this(var_cycle[lhs_idx]) && pruned_by_this(var_cycle[rhs_idx])));
+        cw_assert((lhs_removed_words > 0) == (lhs_removed_pairs > 0) && (rhs_removed_words > 0) == (rhs_removed_pairs > 0));
+
+        // don't report a letter/index pair as removed if no word matching that pair were removed
+        if(lhs_removed_pairs) pruned.emplace_back(var_cycle[lhs_idx], lhs_removed_pairs);
+        if(rhs_removed_pairs) pruned.emplace_back(var_cycle[rhs_idx], rhs_removed_pairs);
     }
-
-    return modified;
 }
 
 /**
@@ -646,8 +653,10 @@ bool cw_cycle::satisfied(const id_obj_manager<cw_variable>& vars) const {
         if(vars[var_cycle[(i + 1) % cycle_len]]->domain.size() != 1) return false;
 
         // invalid assignments are undone, so this should always be true
-        const string lhs_word = vars[var_cycle[i]                  ]->domain.get_cur_domain().at(0).word;
-        const string rhs_word = vars[var_cycle[(i + 1) % cycle_len]]->domain.get_cur_domain().at(0).word;
+        const word_domain& lhs_domain = vars[var_cycle[i]                  ]->domain;
+        const word_domain& rhs_domain = vars[var_cycle[(i + 1) % cycle_len]]->domain;
+        const string_view lhs_word = lhs_domain.get_table().get_str(*lhs_domain.get_cur_domain_ranked().begin());
+        const string_view rhs_word = rhs_domain.get_table().get_str(*rhs_domain.get_cur_domain_ranked().begin());
         cw_assert_m(lhs_word != rhs_word, "word equality between constrainted vars");
         cw_assert_m(lhs_word.at(intersections[i].first) == rhs_word.at(intersections[i].second), "letter inequality at constraint");
     }
@@ -673,15 +682,15 @@ bool cw_cycle::invalid(const id_obj_manager<cw_variable>& vars) const {
 /**
  * @brief get ids of variables upon which this constraint is dependent 
 */
-unordered_set<size_t> cw_cycle::dependencies() const {
-    return {var_cycle.begin(), var_cycle.end()};
+std::span<const size_t> cw_cycle::dependencies() const {
+    return var_cycle;
 }
 
 /**
  * @brief get id of variable upon which other constraints may be dependent
 */
-unordered_set<size_t> cw_cycle::dependents() const {
-    return {var_cycle.begin(), var_cycle.end()};
+std::span<const size_t> cw_cycle::dependents() const {
+    return var_cycle;
 }
 
 /**
@@ -726,3 +735,650 @@ vector<pair<uint, uint> > cw_cycle::intersection_tiles(const id_obj_manager<cw_v
 
     return res;
 }
+
+// ############### cw_alldiff ###############
+
+/**
+ * @brief propagate an assignment, removing its word from the domains of all other unassigned variables of the same length
+ * 
+ * @param vars variables of the csp
+ * @param var id of assigned variable in var_group
+ * @param pruned appended to with {id of variable, 1} for each variable its word was removed from
+*/
+void cw_alldiff::prune_domain(id_obj_manager<cw_variable>& vars, size_t var, pruned_vars_t& pruned) const {
+    const optional<word_id_t> word = vars[var]->domain.get_assigned_value();
+    if(!word.has_value()) {
+        return;
+    }
+
+    for(const size_t other : var_group) {
+        if(other != var && !vars[other]->domain.is_assigned() && vars[other]->domain.remove_word(word.value()) > 0) {
+            pruned.emplace_back(other, 1ul);
+        }
+    }
+}
+
+/**
+ * @brief check for a Hall set, i.e. k unassigned variables with fewer than k distinct words among their domains, 
+ * by searching for a matching of unassigned variables to distinct words with augmenting paths.
+ * every variable in a Hall set has a domain smaller than the # of unassigned variables, so only those are matched,
+ * which keeps matching cheap since such domains are rare and small. words are renumbered densely so the matching
+ * is kept in flat buffers, all reused across calls
+ * 
+ * @param vars variables of the csp
+ * @param scratch buffers to match in, contents on entry are ignored
+ * @return true iff a Hall set exists, so the csp has no solution
+*/
+bool cw_alldiff::hall_violated(const id_obj_manager<cw_variable>& vars, hall_scratch& scratch) const {
+    const size_t num_unassigned = static_cast<size_t>(std::ranges::count_if(var_group, [&vars](size_t var) {
+        return !vars[var]->domain.is_assigned();
+    }));
+
+    scratch.words.clear();
+    scratch.offsets.assign(1ul, 0ul);
+    for(const size_t var : var_group) {
+        if(!vars[var]->domain.is_assigned() && vars[var]->domain.size() < num_unassigned) {
+            vars[var]->domain.append_cur_domain_ids(scratch.words);
+            scratch.offsets.push_back(scratch.words.size());
+        }
+    }
+    const size_t num_domains = scratch.offsets.size() - 1;
+    if(num_domains == 0) {
+        return false;
+    }
+
+    // renumber words by their index among all distinct words
+    scratch.distinct.assign(scratch.words.begin(), scratch.words.end());
+    std::sort(scratch.distinct.begin(), scratch.distinct.end());
+    scratch.distinct.erase(std::unique(scratch.distinct.begin(), scratch.distinct.end()), scratch.distinct.end());
+    for(word_id_t& word : scratch.words) {
+        word = static_cast<word_id_t>(std::lower_bound(scratch.distinct.begin(), scratch.distinct.end(), word) - scratch.distinct.begin());
+    }
+    scratch.matched.assign(scratch.distinct.size(), SIZE_MAX);
+
+    // try to match domain idx to a word, rematching domains already matched along an alternating path
+    auto augment = [&scratch](auto& self, size_t idx) -> bool {
+        for(size_t i = scratch.offsets[idx]; i < scratch.offsets[idx + 1]; ++i) {
+            if(scratch.matched[scratch.words[i]] == SIZE_MAX) {
+                scratch.matched[scratch.words[i]] = idx;
+                return true;
+            }
+        }
+        for(size_t i = scratch.offsets[idx]; i < scratch.offsets[idx + 1]; ++i) {
+            const size_t other = scratch.matched[scratch.words[i]];
+            if(!scratch.visited[other]) {
+                scratch.visited[other] = true;
+                if(self(self, other)) {
+                    scratch.matched[scratch.words[i]] = idx;
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    for(size_t idx = 0; idx < num_domains; ++idx) {
+        scratch.visited.assign(num_domains, false);
+        if(!augment(augment, idx)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ############### level_set_t ###############
+
+/**
+ * @brief find deepest level in a set of levels, e.g. the most recent assignment responsible for a conflict
+ *
+ * @param levels set of levels
+ * @return deepest level in levels, nullopt if empty
+*/
+optional<size_t> cw_csp_data_types_ns::deepest_level(const level_set_t& levels) {
+    for(size_t level = levels.size(); level-- > 0;) {
+        if(levels.test(level)) {
+            return level;
+        }
+    }
+    return std::nullopt;
+}
+
+// ############### restarts ###############
+
+/**
+ * @brief term of the Luby sequence, i.e. 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ..., whose sum up to any term is within a log factor
+ * of the best fixed budget, so restarting by it is never much worse than with a budget known to suit the problem
+ *
+ * @param i index of term, starting from 1
+ * @return i-th term, always a power of 2
+*/
+size_t cw_csp_data_types_ns::luby(size_t i) {
+    cw_assert(i > 0);
+
+    // 2^(k-1) <= i < 2^k, the sequence ends each block 2^k - 1 terms long with 2^(k-1), & otherwise repeats its previous block
+    while(true) {
+        const size_t k = static_cast<size_t>(std::bit_width(i));
+        if(i == (1ul << k) - 1) {
+            return 1ul << (k - 1);
+        }
+        i -= (1ul << (k - 1)) - 1;
+    }
+}
+
+// ############### csr_adjacency ###############
+
+/**
+ * @brief constructor freezing adjacency lists into compressed sparse row form
+ *
+ * @param lists map of row -> entries of that row, rows without lists are empty
+ * @param num_rows number of rows, must exceed every row in lists
+*/
+csr_adjacency::csr_adjacency(const unordered_map<size_t, unordered_set<size_t> >& lists, size_t num_rows) : offsets(num_rows + 1, 0ul) {
+    // count entries of each row, then prefix sum into offsets
+    for(const auto& [row, list] : lists) {
+        cw_assert(row < num_rows);
+        offsets[row + 1] = list.size();
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    entries.resize(offsets.back());
+    for(const auto& [row, list] : lists) {
+        std::copy(list.begin(), list.end(), entries.begin() + static_cast<ptrdiff_t>(offsets[row]));
+    }
+}
+
+// ############### dom_wdeg_heap ###############
+
+/**
+ * @brief constructor for an empty heap over a fixed set of variables
+ *
+ * @param tiebreaks tiebreaks[id] ranks variable id among variables of equal domain size over weighted degree, lower first
+*/
+dom_wdeg_heap::dom_wdeg_heap(vector<uint64_t>&& tiebreaks)
+        : pos(tiebreaks.size(), NOT_IN_HEAP), dom(tiebreaks.size(), 0ul), wdeg(tiebreaks.size(), 1ul), tiebreak(std::move(tiebreaks)) {
+    heap.reserve(pos.size());
+}
+
+/**
+ * @brief add a variable to the heap
+ *
+ * @param var id of variable not in heap
+ * @param dom current domain size of var
+*/
+void dom_wdeg_heap::insert(size_t var, size_t dom) {
+    cw_assert(!contains(var));
+    this->dom[var] = dom;
+    pos[var] = heap.size();
+    heap.push_back(var);
+    sift_up(pos[var]);
+}
+
+/**
+ * @brief remove a variable from the heap, keeping its keys
+ *
+ * @param var id of variable in heap
+*/
+void dom_wdeg_heap::erase(size_t var) {
+    cw_assert(contains(var));
+    const size_t idx = pos[var];
+    pos[var] = NOT_IN_HEAP;
+
+    // fill hole with last entry, which may belong either above or below it
+    const size_t last = heap.back();
+    heap.pop_back();
+    if(last != var) {
+        heap[idx] = last;
+        pos[last] = idx;
+        sift_up(idx);
+        sift_down(pos[last]);
+    }
+}
+
+/**
+ * @brief update domain size of a variable, in heap or not
+ *
+ * @param var id of variable
+ * @param dom current domain size of var
+*/
+void dom_wdeg_heap::set_dom(size_t var, size_t dom) {
+    const size_t prev = this->dom[var];
+    this->dom[var] = dom;
+    if(contains(var) && dom != prev) {
+        if(dom < prev) sift_up(pos[var]);
+        else           sift_down(pos[var]);
+    }
+}
+
+/**
+ * @brief increase weighted degree of a variable, in heap or not
+ *
+ * @param var id of variable
+ * @param delta increase in total weight of constraints on var
+*/
+void dom_wdeg_heap::add_wdeg(size_t var, size_t delta) {
+    wdeg[var] += delta;
+    if(contains(var)) {
+        sift_up(pos[var]);
+    }
+}
+
+/**
+ * @brief compare variables by domain size over weighted degree, then by tiebreak
+ *
+ * @param lhs id of variable
+ * @param rhs id of variable
+ * @return true iff lhs should be selected before rhs
+*/
+bool dom_wdeg_heap::before(size_t lhs, size_t rhs) const {
+    // dom[lhs] / wdeg[lhs] < dom[rhs] / wdeg[rhs] without division
+    const size_t lhs_score = dom[lhs] * wdeg[rhs];
+    const size_t rhs_score = dom[rhs] * wdeg[lhs];
+    return lhs_score < rhs_score || (lhs_score == rhs_score && tiebreak[lhs] < tiebreak[rhs]);
+}
+
+/**
+ * @brief move entry up towards the root while it ranks before its parent
+ *
+ * @param idx index into heap of entry
+*/
+void dom_wdeg_heap::sift_up(size_t idx) {
+    const size_t var = heap[idx];
+    while(idx > 0) {
+        const size_t parent = (idx - 1) / 2;
+        if(!before(var, heap[parent])) {
+            break;
+        }
+        heap[idx] = heap[parent];
+        pos[heap[idx]] = idx;
+        idx = parent;
+    }
+    heap[idx] = var;
+    pos[var] = idx;
+}
+
+/**
+ * @brief move entry down towards the leaves while a child ranks before it
+ *
+ * @param idx index into heap of entry
+*/
+void dom_wdeg_heap::sift_down(size_t idx) {
+    const size_t var = heap[idx];
+    while(2 * idx + 1 < heap.size()) {
+        size_t child = 2 * idx + 1;
+        if(child + 1 < heap.size() && before(heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if(!before(heap[child], var)) {
+            break;
+        }
+        heap[idx] = heap[child];
+        pos[heap[idx]] = idx;
+        idx = child;
+    }
+    heap[idx] = var;
+    pos[var] = idx;
+}
+
+// ############### min_conflicts_fill ###############
+
+/**
+ * @brief constructor for a fill with every variable unfilled
+ *
+ * @param dict dictionary of all words variables may be filled with
+ * @param crossings crossings[id] holds all tiles variable id shares with other variables
+*/
+min_conflicts_fill::min_conflicts_fill(shared_ptr<const word_dict> dict, vector<vector<cw_crossing> >&& crossings)
+        : dict(std::move(dict)), crossings(std::move(crossings)), words(this->crossings.size(), NO_WORD), conflicts(this->crossings.size(), 0ul),
+          buckets(1), bucket_pos(this->crossings.size()) {
+    cw_assert(this->dict);
+    buckets[0].resize(words.size());
+    std::iota(buckets[0].begin(), buckets[0].end(), 0ul);
+    std::iota(bucket_pos.begin(), bucket_pos.end(), 0ul);
+}
+
+/**
+ * @brief fill a variable with a word, updating conflicts of every variable crossing it or filled with either word
+ *
+ * @param var id of variable to fill
+ * @param word id of word to fill var with
+*/
+void min_conflicts_fill::set_word(size_t var, word_id_t word) {
+    cw_assert(var < words.size() && word != NO_WORD);
+    const string_view str = dict->get_str(word);
+    const word_id_t prev = words[var];
+    if(prev == word) {
+        return;
+    }
+
+    // tiles change from conflicting under the previous word, if any, to conflicting under the new one
+    for(const cw_crossing& c : crossings[var]) {
+        if(words[c.other] == NO_WORD) {
+            continue;
+        }
+        const char other_letter = letter(c.other, c.other_index);
+        const bool was_conflict = prev != NO_WORD && letter(var, c.index) != other_letter;
+        const bool is_conflict  = str[c.index] != other_letter;
+        if(was_conflict && !is_conflict) {
+            remove_conflict(var, c.other);
+        } else if(!was_conflict && is_conflict) {
+            add_conflict(var, c.other);
+        }
+    }
+
+    // repeats of the previous word are resolved & repeats of the new word are made
+    if(prev != NO_WORD) {
+        vector<size_t>& prev_fillers = fillers[prev];
+        prev_fillers.erase(std::find(prev_fillers.begin(), prev_fillers.end(), var));
+        for(size_t other : prev_fillers) {
+            remove_conflict(var, other);
+        }
+        if(prev_fillers.empty()) {
+            fillers.erase(prev);
+        }
+    } else {
+        ++num_filled;
+    }
+    vector<size_t>& word_fillers = fillers[word];
+    for(size_t other : word_fillers) {
+        add_conflict(var, other);
+    }
+    word_fillers.push_back(var);
+
+    words[var] = word;
+}
+
+/**
+ * @brief count conflicts a variable would have if filled with a word, without changing the fill
+ *
+ * @param var id of variable
+ * @param word id of word to evaluate for var
+ * @return # of tiles of var whose letter in word differs from the word filling the crossing variable, plus # of other
+ * variables filled with word
+*/
+size_t min_conflicts_fill::cost(size_t var, word_id_t word) const {
+    const string_view str = dict->get_str(word);
+    size_t result = 0;
+    for(const cw_crossing& c : crossings[var]) {
+        if(words[c.other] != NO_WORD && str[c.index] != letter(c.other, c.other_index)) {
+            ++result;
+        }
+    }
+
+    const auto it = fillers.find(word);
+    if(it != fillers.end()) {
+        result += it->second.size() - (words[var] == word ? 1ul : 0ul);
+    }
+    return result;
+}
+
+/**
+ * @brief get the word filling a variable
+ *
+ * @param var id of variable
+ * @return id of word filling var, nullopt if unfilled
+*/
+optional<word_id_t> min_conflicts_fill::word_of(size_t var) const {
+    if(words[var] == NO_WORD) {
+        return std::nullopt;
+    }
+    return words[var];
+}
+
+/**
+ * @brief count a conflict between two variables for both variables, & once in total
+ *
+ * @param lhs id of one variable of conflict
+ * @param rhs id of other variable of conflict
+*/
+void min_conflicts_fill::add_conflict(size_t lhs, size_t rhs) {
+    ++conflicts[lhs];
+    ++conflicts[rhs];
+    ++total;
+    rebucket(lhs, conflicts[lhs] - 1);
+    rebucket(rhs, conflicts[rhs] - 1);
+}
+
+/**
+ * @brief stop counting a conflict between two variables for both variables, & in total
+ *
+ * @param lhs id of one variable of conflict
+ * @param rhs id of other variable of conflict
+*/
+void min_conflicts_fill::remove_conflict(size_t lhs, size_t rhs) {
+    cw_assert(conflicts[lhs] > 0 && conflicts[rhs] > 0);
+    --conflicts[lhs];
+    --conflicts[rhs];
+    --total;
+    rebucket(lhs, conflicts[lhs] + 1);
+    rebucket(rhs, conflicts[rhs] + 1);
+}
+
+/**
+ * @brief move a variable whose # of conflicts changed by one into the bucket of its new # of conflicts
+ *
+ * @param var id of variable
+ * @param prev_conflicts # of conflicts of var before the change, i.e. the bucket holding it
+*/
+void min_conflicts_fill::rebucket(size_t var, size_t prev_conflicts) {
+    // swap out of previous bucket
+    vector<size_t>& prev = buckets[prev_conflicts];
+    cw_assert(prev[bucket_pos[var]] == var);
+    prev[bucket_pos[var]] = prev.back();
+    bucket_pos[prev.back()] = bucket_pos[var];
+    prev.pop_back();
+
+    // into new bucket
+    if(conflicts[var] == buckets.size()) {
+        buckets.emplace_back();
+    }
+    bucket_pos[var] = buckets[conflicts[var]].size();
+    buckets[conflicts[var]].push_back(var);
+
+    // buckets change by one conflict at a time, so the highest bucket can only empty into the one below it
+    max_conflicts = std::max(max_conflicts, conflicts[var]);
+    if(buckets[max_conflicts].empty()) {
+        --max_conflicts;
+    }
+}
+
+/**
+ * @brief get a variable with the most conflicts
+ * @pre fill has conflicts
+ *
+ * @param rng random engine to break ties between variables with the most conflicts
+ * @return id of a variable with the most conflicts, each picked with equal probability
+*/
+size_t min_conflicts_fill::most_conflicted(std::mt19937_64& rng) const {
+    cw_assert(total > 0);
+    const vector<size_t>& most = buckets[max_conflicts];
+    return most[std::uniform_int_distribution<size_t>(0, most.size() - 1)(rng)];
+}
+
+/**
+ * @brief get any variable with conflicts, walking the buckets of at most max_conflicts conflict counts
+ * @pre fill has conflicts
+ *
+ * @param rng random engine to pick variable with
+ * @return id of a variable with conflicts, each picked with equal probability
+*/
+size_t min_conflicts_fill::any_conflicted(std::mt19937_64& rng) const {
+    cw_assert(total > 0);
+    size_t idx = std::uniform_int_distribution<size_t>(0, words.size() - buckets[0].size() - 1)(rng);
+    for(size_t n = 1; ; ++n) {
+        if(idx < buckets[n].size()) {
+            return buckets[n][idx];
+        }
+        idx -= buckets[n].size();
+    }
+}
+
+// ############### lcv_candidates ###############
+
+/**
+ * @brief get the next candidate, sorting the next chunk of candidates first if every sorted one was returned
+ *
+ * @return id of word with the highest key not yet returned, lowest tiebreak first, or nullopt if none are left
+*/
+optional<word_id_t> lcv_candidates::next() {
+    if(num_returned == candidates.size()) {
+        return std::nullopt;
+    }
+
+    if(num_returned == num_sorted) {
+        const size_t chunk_end = std::min(candidates.size(), num_sorted + std::max<size_t>(LCV_CHUNK_SIZE, num_sorted));
+        std::partial_sort(candidates.begin() + static_cast<std::ptrdiff_t>(num_sorted), candidates.begin() + static_cast<std::ptrdiff_t>(chunk_end),
+                          candidates.end(), [](const keyed_candidate& lhs, const keyed_candidate& rhs) {
+            return lhs.key != rhs.key ? lhs.key > rhs.key : lhs.tiebreak < rhs.tiebreak;
+        });
+        num_sorted = chunk_end;
+    }
+    return candidates[num_returned++].word;
+}
+
+// ############### nogood_store ###############
+
+/**
+ * @brief add counters of another store, e.g. of a worker of a parallel search
+ *
+ * @param rhs counters to add
+ * @return ref to this
+*/
+nogood_stats& nogood_stats::operator+=(const nogood_stats& rhs) {
+    learned       += rhs.learned;
+    hits          += rhs.hits;
+    evicted       += rhs.evicted;
+    time_saved_us += rhs.time_saved_us;
+    return *this;
+}
+
+/**
+ * @brief constructor for an empty nogood store
+ *
+ * @param capacity max # of nogoods stored at once
+ * @param max_size max # of assignments in a nogood stored
+*/
+nogood_store::nogood_store(size_t capacity, size_t max_size) : capacity(capacity), max_size(max_size), hand(0ul) {
+    cw_assert(capacity > 0);
+}
+
+/**
+ * @brief store a nogood, evicting another if full
+ *
+ * @param nogood assignments that cannot all be part of a solution
+ * @param cost_us time taken to prove nogood, i.e. time saved each time it is hit
+ * @return true iff nogood was small enough to be stored
+*/
+bool nogood_store::learn(vector<csp_assignment>&& nogood, uint64_t cost_us) {
+    if(nogood.empty() || nogood.size() > max_size) {
+        return false;
+    }
+
+    // once full, advance clock hand past nogoods hit since it last passed them, & replace the first one that was not
+    size_t idx = entries.size();
+    if(entries.size() == capacity) {
+        while(entries[hand].referenced) {
+            entries[hand].referenced = false;
+            hand = (hand + 1) % capacity;
+        }
+        idx = hand;
+        hand = (hand + 1) % capacity;
+
+        for(const csp_assignment& a : entries[idx].assignments) {
+            vector<size_t>& indices = by_word.at(a.word);
+            std::erase(indices, idx);
+            if(indices.empty()) {
+                by_word.erase(a.word);
+            }
+        }
+        ++counters.evicted;
+    } else {
+        entries.emplace_back();
+    }
+
+    for(const csp_assignment& a : nogood) {
+        by_word[a.word].push_back(idx);
+    }
+    entries[idx] = { .assignments = std::move(nogood), .cost_us = cost_us, .referenced = false };
+    ++counters.learned;
+    return true;
+}
+
+// ############### subtree_pool ###############
+
+/**
+ * @brief constructor for pool of open subtrees without any subtrees
+ *
+ * @param num_workers number of workers taking from this pool, each with their own deque
+*/
+subtree_pool::subtree_pool(size_t num_workers) : subtrees(num_workers), subtrees_mx(num_workers), num_open(0ul), num_queued(0ul), num_idle(0ul) {
+    cw_assert(num_workers > 0);
+}
+
+/**
+ * @brief add an open subtree to the newest end of worker's deque
+ *
+ * @param worker owner of subtree
+ * @param subtree assignments from root of search tree to subtree
+*/
+void subtree_pool::push(size_t worker, vector<csp_assignment>&& subtree) {
+    cw_assert(worker < subtrees.size());
+    num_open.fetch_add(1ul);
+
+    lock_guard<mutex> lock(subtrees_mx[worker]);
+    subtrees[worker].push_back(std::move(subtree));
+    num_queued.fetch_add(1ul);
+}
+
+/**
+ * @brief take newest subtree of worker, otherwise steal oldest subtree of next worker with any.
+ * while none are available but some taken subtree is unfinished, wait for it to be finished or split
+ *
+ * @param worker worker to take subtree for
+ * @param stop flag to abandon search
+ * @return assignments from root of search tree to subtree, nullopt if no subtrees will be pushed or stop is set
+*/
+optional<vector<csp_assignment> > subtree_pool::take(size_t worker, const std::atomic<bool>& stop) {
+    cw_assert(worker < subtrees.size());
+
+    // take own newest subtree, depth first
+    {
+        lock_guard<mutex> lock(subtrees_mx[worker]);
+        if(!subtrees[worker].empty()) {
+            vector<csp_assignment> res = std::move(subtrees[worker].back());
+            subtrees[worker].pop_back();
+            num_queued.fetch_sub(1ul);
+            return res;
+        }
+    }
+
+    num_idle.fetch_add(1ul);
+    optional<vector<csp_assignment> > res;
+    while(!res.has_value() && !stop.load(std::memory_order_relaxed) && num_open.load() > 0) {
+        // steal oldest subtree of another worker, i.e. closest to the root and likely largest
+        for(size_t i = 1; i <= subtrees.size() && !res.has_value(); ++i) {
+            const size_t victim = (worker + i) % subtrees.size();
+            lock_guard<mutex> lock(subtrees_mx[victim]);
+            if(!subtrees[victim].empty()) {
+                res = std::move(subtrees[victim].front());
+                subtrees[victim].pop_front();
+                num_queued.fetch_sub(1ul);
+            }
+        }
+
+        // back off rather than spin, so waiting does not take cpu time from busy workers
+        if(!res.has_value()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(SUBTREE_POOL_BACKOFF_US));
+        }
+    }
+    num_idle.fetch_sub(1ul);
+
+    return stop.load(std::memory_order_relaxed) ? std::nullopt : res;
+}
+
+/**
+ * @brief mark a taken subtree as finished
+*/
+void subtree_pool::finish() {
+    cw_assert(num_open.load() > 0);
+    num_open.fetch_sub(1ul);
+}
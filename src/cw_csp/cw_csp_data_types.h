@@ -19,35 +19,65 @@ using namespace word_domain_data_types_ns;
 using namespace word_domain_ns;
 using namespace crossword_data_types_ns;
 
+#define SUBTREE_POOL_BACKOFF_US 100 // time idle workers of a parallel search wait between attempts to steal
+#define MAX_BACKJUMP_LEVELS     512 // max # of assignments tracked for backjumping, searches over more variables backtrack chronologically
+#define NOGOOD_STORE_CAPACITY   4096 // max # of nogoods kept by a search, beyond which nogoods not recently hit are evicted
+#define MAX_NOGOOD_SIZE         6   // max # of assignments in a nogood worth keeping, larger nogoods rarely recur
+#define MAX_HALL_CHECK_VARS     64  // max # of variables of one length whose all-different constraint is checked for Hall sets
+#define RESTART_BASE_FAILURES   1024 // # of failures a run of RESTARTS may hit per unit of the Luby sequence
+#define LOCAL_SEARCH_MAX_STEPS  100000 // max # of words replaced by LOCAL_SEARCH before giving up
+#define LOCAL_SEARCH_TABU_STEPS 10  // # of steps of LOCAL_SEARCH a replaced word may not be put back into its variable
+#define LOCAL_SEARCH_WALK_PROB  0.2  // probability a step of LOCAL_SEARCH replaces a random word of a random conflicting variable
+#define LNS_FAILURE_BUDGET      256 // # of failures a search of LNS may hit before its region is unassigned for another search
+#define LNS_REGION_VARS         8   // # of connected variables LNS unassigns around a hot or random variable
+#define LNS_MAX_ITERS           64  // max # of budgeted searches by LNS before it backtracks over the whole tree
+#define LCV_CHUNK_SIZE          16  // min # of candidates an LCV ordering sorts at a time, larger domains are only sorted as far as searched
+
 namespace cw_csp_data_types_ns {
     // to choose between solving strategies, when more are added in the future
     enum csp_solving_strategy {
-        BACKTRACKING = 0,
+        BACKTRACKING          = 0,
+        PARALLEL_BACKTRACKING = 1, // backtracking over subtrees shared by a pool of threads
+        RESTARTS              = 2, // seeded backtracking restarted whenever a failure budget growing by the Luby sequence runs out
+        LOCAL_SEARCH          = 3, // min-conflicts repair of a complete fill, incomplete so never proves a crossword invalid
+        LNS                   = 4, // large neighbourhood search, re-solving regions of a partial fill by budgeted backtracking
     };
 
     // mapping from csp solve strategy to display name
     NLOHMANN_JSON_SERIALIZE_ENUM( csp_solving_strategy, {
-        {BACKTRACKING, "Backtracking"},
+        {BACKTRACKING,          "Backtracking"},
+        {PARALLEL_BACKTRACKING, "Parallel Backtracking"},
+        {RESTARTS,              "Restarts"},
+        {LOCAL_SEARCH,          "Local Search"},
+        {LNS,                   "Large Neighbourhood Search"},
     })
 
     // criteria for selecting next variable to assign a value to
     enum var_ordering {
-        MRV = 0,
+        MRV        = 0,
+        MRV_DEGREE = 1, // MRV, tiebroken by most constraints on the variable
+        DOM_WDEG   = 2, // smallest domain size over weighted degree, weighting constraints by how often they wiped out a domain
     };
 
     // mapping from variable strategy to display name
     NLOHMANN_JSON_SERIALIZE_ENUM( var_ordering, {
-        {MRV, "Minimum Remaining Values"},
+        {MRV,        "Minimum Remaining Values"},
+        {MRV_DEGREE, "Minimum Remaining Values, Degree"},
+        {DOM_WDEG,   "Domain over Weighted Degree"},
     })
 
     // criteria for selecting next word value to try to assign
     enum val_ordering {
-        HIGH_SCORE_AND_FREQ = 0,
+        HIGH_SCORE_AND_FREQ = 0, // highest score first, tiebroken by frequency
+        LCV                 = 1, // least constraining value, i.e. leaving the most words in crossing variables, tiebroken as above
+        LCV_SCORE           = 2, // LCV weighted by word score, tiebroken as above
     };
 
     // mapping from word strategy to display name
     NLOHMANN_JSON_SERIALIZE_ENUM( val_ordering, {
         {HIGH_SCORE_AND_FREQ, "Highest Score, Frequency"},
+        {LCV,                 "Least Constraining Value"},
+        {LCV_SCORE,           "Least Constraining Value, Score"},
     })
 
     // a variable in a constraint satisfaction problem
@@ -61,7 +91,7 @@ namespace cw_csp_data_types_ns {
         word_domain domain;    // all possible words that fit
 
         // standard constructor for cw_csp
-        cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, string pattern, unordered_set<word_t>&& domain);
+        cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, string pattern, shared_ptr<const word_dict> dict, vector<word_id_t>&& domain);
 
         // testing-only constructor
         cw_variable(size_t id, uint origin_row, uint origin_col, uint length, word_direction dir, unordered_set<word_t>&& domain);
@@ -92,6 +122,10 @@ namespace cw_csp_data_types_ns {
     bool operator==(const unique_ptr<cw_variable>& lhs, const unique_ptr<cw_variable>& rhs);
     ostream& operator<<(ostream& os, const cw_variable& var);
 
+    // variables whose domains were reduced by one propagation step, each with # of letter/index pairs removed from it
+    // a variable may appear more than once. reused across steps by cw_csp so propagation does not allocate
+    using pruned_vars_t = vector<pair<size_t, size_t> >;
+
     // base struct to represent a constraint
     struct cw_constraint {
         public:
@@ -99,16 +133,16 @@ namespace cw_csp_data_types_ns {
             size_t id;
 
             // constraint operations
-            virtual unordered_map<size_t, size_t> prune_domain(id_obj_manager<cw_variable>& vars) = 0;
+            virtual void prune_domain(id_obj_manager<cw_variable>& vars, pruned_vars_t& pruned) = 0;
             virtual bool satisfied(const id_obj_manager<cw_variable>& vars) const = 0;
             virtual bool invalid(const id_obj_manager<cw_variable>& vars) const = 0;
 
             // ids of vars whose domain modification need re-evaluation of this constraint
             // used to build constr_dependencies table in cw_csp
-            virtual unordered_set<size_t> dependencies() const = 0;
+            virtual std::span<const size_t> dependencies() const = 0;
 
             // ids of var which may be modified in prune_domain(), possibly affecting dependent constraints
-            virtual unordered_set<size_t> dependents() const = 0;
+            virtual std::span<const size_t> dependents() const = 0;
 
             // number of variables traversed over
             virtual size_t size() const = 0;
@@ -144,7 +178,7 @@ namespace cw_csp_data_types_ns {
 
     // equality constraints between 2 letters in 2 cw vars
     // uni-directional, in constraint set both a constraint and its reverse must both exist
-    struct cw_arc : public cw_constraint {
+    struct cw_arc final : public cw_constraint {
         uint lhs_index;                                      // index of shared letter in lhs
         uint rhs_index;                                      // index of shared letter in rhs
         size_t lhs{id_obj_manager<cw_variable>::INVALID_ID}; // index of lhs var in an id_obj_manager
@@ -157,7 +191,7 @@ namespace cw_csp_data_types_ns {
         cw_arc(size_t id, uint lhs_index, uint rhs_index, size_t lhs, size_t rhs);
 
         // AC-3 step; remove all words in lhs domain that don't have a corresponding rhs word in its domain
-        virtual unordered_map<size_t, size_t> prune_domain(id_obj_manager<cw_variable>& vars) override;
+        virtual void prune_domain(id_obj_manager<cw_variable>& vars, pruned_vars_t& pruned) override;
 
         // used by solved() in cw_csp to check that this constraint is satisfied
         virtual bool satisfied(const id_obj_manager<cw_variable>& vars) const override;
@@ -166,10 +200,10 @@ namespace cw_csp_data_types_ns {
         virtual bool invalid(const id_obj_manager<cw_variable>& vars) const override;
 
         // only dependency is rhs
-        virtual unordered_set<size_t> dependencies() const override;
+        virtual std::span<const size_t> dependencies() const override;
 
         // only dependent is lhs
-        virtual unordered_set<size_t> dependents() const override;
+        virtual std::span<const size_t> dependents() const override;
 
         // always traverses over exactly 2 variables
         virtual size_t size() const override;
@@ -197,11 +231,14 @@ namespace cw_csp_data_types_ns {
     // cycle constraint between 4 distinct variables
     // the last arc rhs variable is the lhs variable in the first arc
     // adjacent lhs and rhs variables in different adjacent arcs are the same
-    struct cw_cycle : public cw_constraint {
+    struct cw_cycle final : public cw_constraint {
         // for performance reasons, these are restricted
         static constexpr size_t MIN_CYCLE_LEN = 4ul;
         static constexpr size_t MAX_CYCLE_LEN = 4ul;
 
+        // one letter bitmap per intersection of the cycle, for pruning without allocation
+        using cycle_layers_t = array<letter_bitset_t, MAX_CYCLE_LEN>;
+
         // the length of var_cycle and intersections
         size_t cycle_len;
 
@@ -219,7 +256,7 @@ namespace cw_csp_data_types_ns {
         cw_cycle(size_t id, const vector<size_t>& var_cycle, const vector<pair<uint, uint> >& intersections);
 
         // AC-N step; remove all words in first var's domain that don't have a path to the last var
-        virtual unordered_map<size_t, size_t> prune_domain(id_obj_manager<cw_variable>& vars) override;
+        virtual void prune_domain(id_obj_manager<cw_variable>& vars, pruned_vars_t& pruned) override;
 
         // used by solved() in cw_csp to check that this constraint is satisfied
         virtual bool satisfied(const id_obj_manager<cw_variable>& vars) const override;
@@ -228,10 +265,10 @@ namespace cw_csp_data_types_ns {
         virtual bool invalid(const id_obj_manager<cw_variable>& vars) const override;
 
         // all elements in var_cycle are dependencies
-        virtual unordered_set<size_t> dependencies() const override;
+        virtual std::span<const size_t> dependencies() const override;
 
         // all elements in var_cycle are dependents
-        virtual unordered_set<size_t> dependents() const override;
+        virtual std::span<const size_t> dependents() const override;
 
         // traverses over one variable per element in var_cycle
         virtual size_t size() const override;
@@ -255,6 +292,405 @@ namespace cw_csp_data_types_ns {
 
         virtual ~cw_cycle() override = default;
     };
+
+    // constraints stored by value & by type, for propagation with direct calls rather than virtual calls through cw_constraint
+    using constraint_variant_t = std::variant<cw_arc, cw_cycle>;
+
+    // all-different constraint over words of all variables of one length
+    // not a cw_constraint, since it only propagates upon assignments rather than upon any pruning of its variables
+    // buffers reused by every cw_alldiff::hall_violated() call of a csp, so checking for Hall sets does not allocate once warmed up
+    struct hall_scratch {
+        vector<word_id_t> words;      // words of domains to match, concatenated, then replaced by their index in distinct
+        vector<size_t> offsets;       // domain i is words[offsets[i], offsets[i + 1])
+        vector<word_id_t> distinct;   // all distinct words of domains to match, sorted
+        vector<size_t> matched;       // matched[i] is the domain matched to distinct[i], or SIZE_MAX if unmatched
+        vector<bool> visited;         // visited[i] iff domain i is on the current augmenting path
+    };
+
+    struct cw_alldiff {
+        // ids of all variables of one length, at least 2
+        vector<size_t> var_group;
+
+        // value constructor
+        explicit cw_alldiff(vector<size_t>&& var_group) : var_group(std::move(var_group)) {}
+
+        // remove word assigned to var from domains of all other unassigned variables in var_group
+        void prune_domain(id_obj_manager<cw_variable>& vars, size_t var, pruned_vars_t& pruned) const;
+
+        // returns true iff unassigned variables in var_group cannot all be assigned distinct words from their domains
+        bool hall_violated(const id_obj_manager<cw_variable>& vars, hall_scratch& scratch) const;
+    };
+
+    /**
+     * @brief immutable adjacency lists of rows [0, num_rows()) frozen into compressed sparse row form,
+     * i.e. all lists concatenated into one array with the offset of each row's list alongside
+    */
+    class csr_adjacency {
+        public:
+            // no rows
+            csr_adjacency() : offsets(1ul, 0ul) {}
+
+            // freeze lists, where row i holds lists.at(i) in its iteration order if present, otherwise is empty
+            csr_adjacency(const unordered_map<size_t, unordered_set<size_t> >& lists, size_t num_rows);
+
+            // entries of row
+            std::span<const size_t> operator[](size_t row) const {
+                cw_assert(row + 1 < offsets.size());
+                return std::span<const size_t>(entries.data() + offsets[row], offsets[row + 1] - offsets[row]);
+            }
+
+            // # of rows, including empty rows
+            size_t num_rows() const { return offsets.size() - 1; }
+
+        private:
+            // row i is entries[offsets[i], offsets[i + 1])
+            vector<size_t> offsets;
+            vector<size_t> entries;
+    };
+
+    /**
+     * @brief indexed binary min-heap of variables by domain size over weighted degree, for the DOM_WDEG ordering.
+     * keys of all variables are kept whether or not they are in the heap, & each update of a key in the heap costs O(log n)
+    */
+    class dom_wdeg_heap {
+        public:
+            // heap of no variables
+            dom_wdeg_heap() = default;
+
+            // empty heap of variables [0, num_vars) with all domain sizes 0 & weighted degrees 1, ties broken by lower tiebreaks[id]
+            dom_wdeg_heap(vector<uint64_t>&& tiebreaks);
+
+            // add var with domain size dom to heap
+            void insert(size_t var, size_t dom);
+
+            // remove var from heap
+            void erase(size_t var);
+
+            // update keys of var
+            void set_dom(size_t var, size_t dom);
+            void add_wdeg(size_t var, size_t delta);
+
+            // variable with smallest domain size over weighted degree
+            size_t top() const { cw_assert(!heap.empty()); return heap.front(); }
+
+            bool contains(size_t var) const { return pos[var] != NOT_IN_HEAP; }
+            bool empty() const { return heap.empty(); }
+
+        private:
+            static constexpr size_t NOT_IN_HEAP = SIZE_MAX;
+
+            // true iff lhs ranks before rhs, comparing dom/wdeg by cross multiplying
+            bool before(size_t lhs, size_t rhs) const;
+
+            // restore heap order from an entry whose key decreased or increased
+            void sift_up(size_t idx);
+            void sift_down(size_t idx);
+
+            // ids of variables in heap order, & the index of each variable in heap
+            vector<size_t> heap;
+            vector<size_t> pos;
+
+            // keys of each variable
+            vector<size_t> dom;
+            vector<size_t> wdeg;
+            vector<uint64_t> tiebreak;
+    };
+
+    // tile shared by a variable with a crossing variable
+    struct cw_crossing {
+        uint index;       // index of shared letter in variable
+        size_t other;     // id of crossing variable
+        uint other_index; // index of shared letter in crossing variable
+    };
+
+    /**
+     * @brief complete fill of variables with words for local search, which may conflict at crossing tiles or by repeating words.
+     * conflicts of each variable are counted incrementally, so replacing a word costs O(# of tiles it crosses + # of repeats)
+    */
+    class min_conflicts_fill {
+        public:
+            // fill of no variables
+            min_conflicts_fill() = default;
+
+            // empty fill of variables [0, crossings.size()), where crossings[id] holds all tiles variable id shares
+            min_conflicts_fill(shared_ptr<const word_dict> dict, vector<vector<cw_crossing> >&& crossings);
+
+            // fill var with word, replacing its word if any
+            void set_word(size_t var, word_id_t word);
+
+            // # of conflicts var would have if filled with word, with crossing variables not yet filled conflicting with nothing
+            size_t cost(size_t var, word_id_t word) const;
+
+            // word filling var, if any
+            optional<word_id_t> word_of(size_t var) const;
+
+            // # of tiles of var conflicting with crossing words, plus # of other variables filled with the same word
+            size_t conflicts_of(size_t var) const { return conflicts[var]; }
+
+            // # of conflicts in the fill, each counted once though it counts for both its variables, a fill is a solution iff complete with none
+            size_t total_conflicts() const { return total; }
+            bool complete() const { return num_filled == words.size(); }
+
+            // variable with the most conflicts, or any variable with conflicts, each tie or choice picked uniformly with rng
+            // a fill with conflicts is required
+            size_t most_conflicted(std::mt19937_64& rng) const;
+            size_t any_conflicted(std::mt19937_64& rng) const;
+
+        private:
+            static constexpr word_id_t NO_WORD = UINT32_MAX;
+
+            // letter of word filling var at index
+            char letter(size_t var, uint index) const { return dict->get_str(words[var])[index]; }
+
+            // count a conflict between both variables of it, or stop counting it
+            void add_conflict(size_t lhs, size_t rhs);
+            void remove_conflict(size_t lhs, size_t rhs);
+
+            // move var into the bucket of its current # of conflicts, from the bucket of prev_conflicts
+            void rebucket(size_t var, size_t prev_conflicts);
+
+            shared_ptr<const word_dict> dict;
+            vector<vector<cw_crossing> > crossings;
+
+            // words[id] fills variable id, NO_WORD if unfilled
+            vector<word_id_t> words;
+            size_t num_filled = 0;
+
+            // fillers[word] contains all variables filled with word
+            unordered_map<word_id_t, vector<size_t> > fillers;
+
+            // conflicts[id] is # of conflicts of variable id, & total half their sum
+            vector<size_t> conflicts;
+            size_t total = 0;
+
+            // buckets[n] contains all variables with n conflicts, at index bucket_pos[id] for variable id, so the most conflicted
+            // variables are found without scanning every variable. max_conflicts is the highest n with a nonempty bucket
+            vector<vector<size_t> > buckets;
+            vector<size_t> bucket_pos;
+            size_t max_conflicts = 0;
+    };
+
+    /**
+     * @brief candidates of a variable under an LCV ordering, each keyed by how many words it would leave in crossing variables.
+     * candidates are only sorted in chunks as they are requested, each chunk as large as all chunks before it, so a search that
+     * succeeds or backjumps after a few candidates sorts O(LCV_CHUNK_SIZE) of them rather than its whole domain
+    */
+    class lcv_candidates {
+        public:
+            // no candidates
+            lcv_candidates() = default;
+
+            // add word with key, to be returned after all candidates with a higher key, or an equal key & lower tiebreak
+            void push(double key, uint64_t tiebreak, word_id_t word) { candidates.push_back({key, tiebreak, word}); }
+
+            // reserve space for n candidates
+            void reserve(size_t n) { candidates.reserve(n); }
+
+            // next candidate in order, or nullopt once every candidate was returned
+            optional<word_id_t> next();
+
+        private:
+            struct keyed_candidate {
+                double key;
+                uint64_t tiebreak;
+                word_id_t word;
+            };
+
+            vector<keyed_candidate> candidates;
+
+            // candidates[0, num_sorted) are in order, & candidates[0, num_returned) were returned
+            size_t num_sorted   = 0;
+            size_t num_returned = 0;
+    };
+
+    /**
+     * @brief FIFO queue of distinct ids in [0, capacity), as a fixed capacity ring buffer with a bitset of ids in queue.
+     * since an id is never in the queue twice, a capacity of ids is never exceeded
+    */
+    class id_queue {
+        public:
+            // empty queue of no ids
+            id_queue() : head(0ul), count(0ul) {}
+
+            // empty queue of ids in [0, capacity)
+            id_queue(size_t capacity) : ring(capacity), queued(capacity, false), head(0ul), count(0ul) {}
+
+            // add id to back of queue iff not already in queue, returns true iff added
+            bool push(size_t id) {
+                cw_assert(id < queued.size());
+                if(queued[id]) {
+                    return false;
+                }
+                cw_assert(count < ring.size());
+                size_t tail = head + count;
+                if(tail >= ring.size()) tail -= ring.size();
+                ring[tail] = id;
+                queued[id] = true;
+                ++count;
+                return true;
+            }
+
+            // remove & return id at front of queue
+            size_t pop() {
+                cw_assert(count > 0);
+                const size_t id = ring[head];
+                cw_assert(queued[id]);
+                queued[id] = false;
+                if(++head == ring.size()) head = 0ul;
+                --count;
+                return id;
+            }
+
+            // remove all ids from queue
+            void clear() {
+                while(count > 0) pop();
+                head = 0ul;
+            }
+
+            bool empty() const { return count == 0; }
+            size_t size() const { return count; }
+
+        private:
+            // ids in queue are ring[head], ring[head + 1], ... for count ids, wrapping around
+            vector<size_t> ring;
+
+            // queued[id] true iff id in queue
+            vector<bool> queued;
+
+            size_t head;
+            size_t count;
+    };
+
+    // a word assigned to a variable during search
+    struct csp_assignment {
+        size_t var;     // id of assigned variable
+        word_id_t word; // id of word assigned to var
+    };
+
+    // set of levels of a search, i.e. indices of assignments leading from the root of the search tree to a node
+    using level_set_t = std::bitset<MAX_BACKJUMP_LEVELS>;
+
+    // deepest level in levels, nullopt if empty
+    optional<size_t> deepest_level(const level_set_t& levels);
+
+    // i-th term of the Luby sequence 1, 1, 2, 1, 1, 2, 4, ..., 1-indexed
+    size_t luby(size_t i);
+
+    // counters of a nogood_store, to measure the gain of nogood learning
+    struct nogood_stats {
+        size_t   learned       = 0; // # of nogoods stored
+        size_t   hits          = 0; // # of candidates rejected by a stored nogood
+        size_t   evicted       = 0; // # of nogoods evicted to stay within capacity
+        uint64_t time_saved_us = 0; // time originally taken to prove each nogood hit, summed over hits
+
+        nogood_stats& operator+=(const nogood_stats& rhs);
+    };
+
+    /**
+     * @brief nogoods learned during search, i.e. sets of assignments that cannot all be part of a solution, indexed by the words they assign.
+     * once full, nogoods are evicted in order of age, except that a nogood hit since it was last passed over is spared once (clock policy)
+    */
+    class nogood_store {
+        public:
+            // store of at most capacity nogoods, each of at most max_size assignments
+            nogood_store(size_t capacity, size_t max_size);
+
+            // store nogood, which took cost_us to prove, returns true iff stored
+            bool learn(vector<csp_assignment>&& nogood, uint64_t cost_us);
+
+            // stored nogood containing candidate, whose other assignments all hold, nullptr if none
+            template<typename Holds>
+            const vector<csp_assignment>* find(const csp_assignment& candidate, Holds holds);
+
+            // counters since construction, including those added from other stores
+            const nogood_stats& stats() const { return counters; }
+            void add_stats(const nogood_stats& other) { counters += other; }
+
+        private:
+            struct entry {
+                vector<csp_assignment> assignments;
+                uint64_t cost_us;    // time taken to prove this nogood
+                bool     referenced; // hit since the clock hand last passed over this nogood
+            };
+
+            size_t capacity;
+            size_t max_size;
+
+            // stored nogoods, & the next to consider evicting once full
+            vector<entry> entries;
+            size_t hand;
+
+            // indices into entries of all nogoods assigning each word
+            unordered_map<word_id_t, vector<size_t> > by_word;
+
+            nogood_stats counters;
+    };
+
+    /**
+     * @brief find a stored nogood that assigning candidate would complete
+     *
+     * @param candidate assignment about to be made
+     * @param holds predicate true iff an assignment currently holds
+     * @return assignments of nogood containing candidate whose other assignments all hold, nullptr if none
+    */
+    template<typename Holds>
+    const vector<csp_assignment>* nogood_store::find(const csp_assignment& candidate, Holds holds) {
+        const auto it = by_word.find(candidate.word);
+        if(it == by_word.end()) {
+            return nullptr;
+        }
+
+        for(size_t idx : it->second) {
+            entry& e = entries[idx];
+            const bool completed = std::ranges::all_of(e.assignments, [&](const csp_assignment& a) {
+                return (a.var == candidate.var && a.word == candidate.word) || (a.word != candidate.word && holds(a));
+            });
+            if(completed) {
+                e.referenced = true;
+                ++counters.hits;
+                counters.time_saved_us += e.cost_us;
+                return &e.assignments;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief open subtrees of a parallel search, each the assignments leading from the root of the search tree to it.
+     * each worker owns a deque of subtrees, taking its newest subtree first and stealing the oldest subtree of another worker when its own is empty
+    */
+    class subtree_pool {
+        public:
+            // pool for num_workers workers, initially without any subtrees
+            subtree_pool(size_t num_workers);
+
+            // add open subtree to be searched, owned by worker
+            void push(size_t worker, vector<csp_assignment>&& subtree);
+
+            // take next subtree for worker to search, waiting while other workers may still push more
+            // nullopt once every subtree pushed has finished or stop is set
+            optional<vector<csp_assignment> > take(size_t worker, const std::atomic<bool>& stop);
+
+            // mark subtree returned by take() as finished, after pushing any subtrees split from it
+            void finish();
+
+            // true iff some worker is waiting for a subtree to search and none are left to steal
+            bool hungry() const { return num_idle.load(std::memory_order_relaxed) > 0 && num_queued.load(std::memory_order_relaxed) == 0; }
+
+        private:
+            // subtrees owned by each worker, oldest at front
+            vector<deque<vector<csp_assignment> > > subtrees;
+            vector<mutex> subtrees_mx;
+
+            // # of subtrees pushed and not yet finished
+            std::atomic<size_t> num_open;
+
+            // # of subtrees pushed and not yet taken
+            std::atomic<size_t> num_queued;
+
+            // # of workers waiting in take()
+            std::atomic<size_t> num_idle;
+    };
 } // cw_csp_data_types_ns
 
 /**
@@ -6,6 +6,8 @@
 
 #include "cw_tree.h"
 
+#include <thread>
+
 using namespace cw_tree_ns;
 
 /**
@@ -13,27 +15,57 @@ using namespace cw_tree_ns;
  *
  * @param name name for this tree
  * @param grid rvalue user input crossword grid to solve, assume ownership of, and generate csp permutations to solve with
- * @param filepath relative filepath to dictionary of words file
+ * @param filepath relative filepath to dictionary of words file, parsed at most once per process
  * @param print_progress_bar csp displays progress bar iff true
  * @param trace_header csp enables cw_tracer iff has a value
  */
 cw_tree::cw_tree(const string& name, crossword&& grid, const std::filesystem::path& filepath, bool print_progress_bar, const optional<string>& trace_header)
+    : cw_tree(name, std::move(grid), word_dict::load(filepath, print_progress_bar), print_progress_bar, trace_header) {
+    // do nothing, delegated to constructor does everything needed
+}
+
+/**
+ * @brief constructor for cw_tree with a dictionary already loaded
+ *
+ * @param name name for this tree
+ * @param grid rvalue user input crossword grid to solve, assume ownership of, and generate csp permutations to solve with
+ * @param dict shared dictionary of words, used by every csp in this tree
+ * @param print_progress_bar csp displays progress bar iff true
+ * @param trace_header csp enables cw_tracer iff has a value
+ */
+cw_tree::cw_tree(const string& name, crossword&& grid, shared_ptr<const word_dict> dict, bool print_progress_bar, const optional<string>& trace_header)
     : common_parent(name, VERBOSITY),
       init_grid(std::move(grid)),
-      filepath(filepath),
+      dict(std::move(dict)),
       print_progress_bar(print_progress_bar),
       trace_header(trace_header) {
-    // do nothing else
+    cw_assert(this->dict);
 }
 
 /**
- * @brief search for solutions with a single thread. cw_tree will continue to search until num_solutions are found or search space exhausted
+ * @brief search for solutions. cw_tree will continue to search until num_solutions are found or search space exhausted
  * 
  * @param num_solutions maximum number of solutions to return
  * @param allow_permutations allow searches on permutated grids if domain exhausted
+ * @param num_threads number of solvers to race on the initial grid, or of threads to split the search of each permutated grid among
+ * @param seed nonzero seed to search with RESTARTS instead of BACKTRACKING, if provided
+ * @param val_order value ordering every search tries candidate words in
+ * @param strategy BACKTRACKING, LOCAL_SEARCH to search the initial grid only, with one thread, by min-conflicts,
+ *                 or LNS to search each grid with one thread by repeatedly relaxing & re-solving regions of a partial fill
  */
-vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations) {
+vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations, size_t num_threads, optional<uint64_t> seed, val_ordering val_order,
+                              csp_solving_strategy strategy) {
     cw_assert(num_solutions > 0);
+    cw_assert(num_threads > 0);
+    cw_assert(seed.value_or(1ul) != 0);
+    cw_assert(strategy == BACKTRACKING || strategy == LOCAL_SEARCH || strategy == LNS);
+    cw_assert_m(strategy != LOCAL_SEARCH || (!allow_permutations && num_threads == 1), "local search only solves the initial grid with one thread");
+    cw_assert_m(strategy != LNS || num_threads == 1, "lns only solves with one thread");
+
+    // single threaded backtracking restarts iff seeded, so results are reproducible from the seed
+    if(strategy == BACKTRACKING && seed.has_value()) {
+        strategy = RESTARTS;
+    }
     vector<string> result;
     
     // TODO: feature currently not supported
@@ -42,11 +74,16 @@ vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations) {
     }
 
     // temporary implementation of finding single solution if permutations disallowed
-    if(!allow_permutations) {
-        cw_csp csp(name + " cw_csp", std::move(init_grid), filepath, print_progress_bar, trace_header.has_value());
+    if(!allow_permutations && num_threads > 1) {
+        if(optional<string> solution = solve_portfolio(num_threads, seed, val_order)) {
+            result.push_back(std::move(solution.value()));
+        }
+    } else if(!allow_permutations) {
+        cw_csp csp(name + " cw_csp", std::move(init_grid), dict, print_progress_bar, trace_header.has_value());
 
         // find single solution
-        if(csp.solve(BACKTRACKING, MRV, HIGH_SCORE_AND_FREQ)) {
+        csp.set_seed(seed.value_or(0ul));
+        if(csp.solve(strategy, MRV, val_order)) {
             cw_assert(csp.solved());
             result.push_back(csp.result());
         }
@@ -68,7 +105,7 @@ vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations) {
         // init current layer with depth=0, i.e. csp on initial grid
         vector<cw_csp> cur_layer;
         size_t cur_idx = 0ul;
-        cur_layer.push_back(cw_csp(name + " cw_csp", std::move(init_grid), filepath, print_progress_bar, trace_header.has_value()));
+        cur_layer.push_back(cw_csp(name + " cw_csp", std::move(init_grid), dict, print_progress_bar, trace_header.has_value()));
 
         // create subdirectory for any trace files to be written into
         if(trace_header.has_value()) {
@@ -80,7 +117,9 @@ vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations) {
         while(num_solutions > 0 && cur_layer.size()) {
             if(cur_idx < cur_layer.size()) {
                 // still have more csps to process in current layer
-                if(cur_layer.at(cur_idx).solve(BACKTRACKING, MRV, HIGH_SCORE_AND_FREQ)) {
+                cur_layer.at(cur_idx).set_num_threads(num_threads);
+                cur_layer.at(cur_idx).set_seed(seed.value_or(0ul));
+                if(cur_layer.at(cur_idx).solve(num_threads > 1 ? PARALLEL_BACKTRACKING : strategy, MRV, val_order)) {
                     cw_assert(cur_layer.at(cur_idx).solved());
                     result.push_back(cur_layer.at(cur_idx).result());
                     --num_solutions;
@@ -109,3 +148,70 @@ vector<string> cw_tree::solve(size_t num_solutions, bool allow_permutations) {
 
     return result;
 }
+
+/**
+ * @brief race a portfolio of solvers on the initial grid, one per thread, each with its own variable ordering and tiebreak seed.
+ * solver 0 is ordered identically to a single threaded search. all solvers stop as soon as one finds a solution or exhausts its domain,
+ * since exhaustion by any ordering proves no solution exists
+ *
+ * @param num_threads number of solvers to race
+ * @param seed if provided, solvers are seeded from it instead of by index, & restart under RESTARTS
+ * @param val_order value ordering every solver tries candidate words in
+ * @return solution of first solver to succeed, if any
+ */
+optional<string> cw_tree::solve_portfolio(size_t num_threads, optional<uint64_t> seed, val_ordering val_order) {
+    cw_assert(num_threads > 1);
+
+    // set by first solver to finish its search
+    shared_ptr<std::atomic<bool> > stop = make_shared<std::atomic<bool> >(false);
+
+    // each solver builds its own csp in its own thread, dictionary is shared read only
+    vector<unique_ptr<cw_csp> > solvers(num_threads);
+    optional<string> result;
+    size_t winner = 0ul;
+    mutex result_mx;
+
+    // solvers rotate through variable orderings, starting from the one a single threaded search uses
+    constexpr array<var_ordering, 3> orderings = {MRV, MRV_DEGREE, DOM_WDEG};
+
+    auto race = [&](size_t idx) {
+        solvers[idx] = make_unique<cw_csp>(
+            name + " cw_csp " + std::to_string(idx),
+            crossword(name + " crossword " + std::to_string(idx), init_grid.cols(), init_grid.rows(), init_grid.init_contents()),
+            dict, print_progress_bar && idx == 0, trace_header.has_value()
+        );
+        solvers[idx]->set_seed(seed.has_value() ? seed.value() + idx : idx);
+        solvers[idx]->set_stop_flag(stop);
+
+        const bool success = solvers[idx]->solve(seed.has_value() ? RESTARTS : BACKTRACKING, orderings[idx % orderings.size()], val_order);
+
+        // solvers that returned due to the stop flag have nothing to report
+        lock_guard<mutex> lock(result_mx);
+        if(!stop->load()) {
+            if(success) {
+                cw_assert(solvers[idx]->solved());
+                result = solvers[idx]->result();
+            }
+            winner = idx;
+            stop->store(true);
+        }
+    };
+
+    vector<std::thread> threads;
+    for(size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back(race, i);
+    }
+    for(std::thread& t : threads) {
+        t.join();
+    }
+
+    utils.log(INFO, "cw_tree portfolio finished by solver ", winner);
+
+    // save trace result of solver that finished search to instrumentation file
+    if(trace_header.has_value()) {
+        const std::filesystem::path fp = trace_header.value() + ".json";
+        solvers[winner]->save_trace_result(fp);
+    }
+
+    return result;
+}
@@ -11,11 +11,13 @@
 #include "../utils/cw_utils.h"
 #include "../common/common_parent.h"
 #include "../cw_csp/cw_csp.h"
+#include "../word_dict/word_dict.h"
 
 using namespace common_data_types_ns;
 using namespace cw;
 using namespace common_parent_ns;
 using namespace cw_csp_ns;
+using namespace word_dict_ns;
 
 namespace cw_tree_ns {
     /**
@@ -25,16 +27,27 @@ namespace cw_tree_ns {
         public:
             // base constructor, agnostic to grid layout
             cw_tree(const string& name, crossword&& grid, const std::filesystem::path& filepath, bool print_progress_bar, const optional<string>& trace_header);
+
+            // constructor with already loaded dictionary, agnostic to grid layout
+            cw_tree(const string& name, crossword&& grid, shared_ptr<const word_dict> dict, bool print_progress_bar, const optional<string>& trace_header);
             
-            // singlethreaded search for 1 solution per permutated grid, returning up to num_solutions results
-            vector<string> solve(size_t num_solutions, bool allow_permutations);
+            // search for 1 solution per permutated grid, returning up to num_solutions results
+            // without permutations, num_threads solvers race on the initial grid, otherwise num_threads split the search of each grid
+            // if seeded, single threaded searches & solvers of a race restart with randomized tiebreaks
+            // LOCAL_SEARCH replaces backtracking on a single grid with a single thread, since its failures prove nothing
+            // LNS replaces backtracking with a single thread, on every grid since it still proves when none has a solution
+            vector<string> solve(size_t num_solutions, bool allow_permutations, size_t num_threads = 1ul, optional<uint64_t> seed = std::nullopt,
+                                 val_ordering val_order = HIGH_SCORE_AND_FREQ, csp_solving_strategy strategy = BACKTRACKING);
         
         protected:
+            // race a portfolio of num_threads differently ordered solvers on the initial grid, returning the first solution found
+            optional<string> solve_portfolio(size_t num_threads, optional<uint64_t> seed, val_ordering val_order);
+
             // initial user input grid, undefined once solve() is called
             crossword init_grid;
 
-            // original word dictionary filepath
-            std::filesystem::path filepath;
+            // word dictionary shared by all csp in this tree
+            shared_ptr<const word_dict> dict;
 
             // original progress bar enabling for searching and domain building
             bool print_progress_bar;
@@ -0,0 +1,542 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: class implementation for immutable word dictionary shared by all cw_csp
+// ==================================================================
+
+#include "word_dict.h"
+
+using namespace word_dict_ns;
+
+/**
+ * @brief definition of process-wide dictionary cache and its mutex
+*/
+mutex word_dict::cache_mx;
+unordered_map<string, shared_ptr<const word_dict> > word_dict::cache;
+
+/**
+ * @brief get the process-wide copy of a dictionary, parsing it only if no prior call requested the same file
+ * @note thread-safe, concurrent callers requesting a file not yet loaded wait for the first caller to finish parsing
+ *
+ * @param filepath path to .txt, .json, or compiled .cwdict file containing word data
+ * @param print_progress_bar displays progress bar iff true and file not yet loaded, default: false
+ * @return ptr to shared immutable dictionary
+*/
+shared_ptr<const word_dict> word_dict::load(const std::filesystem::path& filepath, bool print_progress_bar) {
+    // different relative paths to the same file should share one dictionary
+    const string key = std::filesystem::weakly_canonical(filepath).string();
+
+    lock_guard<mutex> cache_lg(cache_mx);
+    auto it = cache.find(key);
+    if(it == cache.end()) {
+        it = cache.emplace(key, make_shared<const word_dict>("word_dict " + filepath.filename().string(), filepath, print_progress_bar)).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief constructor for word_dict, maps a compiled image if one at least as new as filepath exists, otherwise parses filepath
+ *
+ * @param name the name of this object
+ * @param filepath path to .txt, .json, or compiled .cwdict file containing word data
+ * @param print_progress_bar displays progress bar iff true and file must be parsed
+*/
+word_dict::word_dict(const string& name, const std::filesystem::path& filepath, bool print_progress_bar)
+        : common_parent(name, VERBOSITY),
+          path(filepath),
+          header(nullptr),
+          words(nullptr),
+          nodes(nullptr),
+          lists(nullptr),
+          postings(nullptr),
+          pool(nullptr) {
+    // compiled image requested directly, no source to fall back to
+    if(filepath.extension() == DICT_IMAGE_EXTENSION) {
+        cw_assert_m(try_map_image(filepath), "could not map compiled dictionary image " + filepath.string());
+        return;
+    }
+
+    // prefer compiled image of source file if it is up to date
+    const std::filesystem::path image = image_path(filepath);
+    std::error_code ec;
+    if(std::filesystem::exists(image, ec)) {
+        if(std::filesystem::last_write_time(image, ec) < std::filesystem::last_write_time(filepath, ec)) {
+            utils.log(WARNING, "ignoring stale compiled dictionary image ", image.string(), ", rebuild with cw_dictc");
+        } else if(try_map_image(image)) {
+            utils.log(INFO, "mapped compiled dictionary image ", image.string());
+            return;
+        } else {
+            utils.log(WARNING, "ignoring unreadable or incompatible compiled dictionary image ", image.string());
+        }
+    }
+
+    compile_words(read_words(filepath, print_progress_bar));
+}
+
+/**
+ * @brief constructor for word_dict with words already parsed, compiled in memory and not associated with any file
+ *
+ * @param name the name of this object
+ * @param words all words to include, in any order, which must be unique, lowercase, and of legal length
+*/
+word_dict::word_dict(const string& name, vector<word_t>&& words)
+        : common_parent(name, VERBOSITY),
+          header(nullptr),
+          words(nullptr),
+          nodes(nullptr),
+          lists(nullptr),
+          postings(nullptr),
+          pool(nullptr) {
+    compile_words(std::move(words));
+}
+
+/**
+ * @brief helper for constructor to map a compiled image and bind views to it
+ *
+ * @param image path to compiled .cwdict file
+ * @return true iff image was mapped and is well formed
+*/
+bool word_dict::try_map_image(const std::filesystem::path& image) {
+    unique_ptr<mapped_file> m = make_unique<mapped_file>(image);
+    if(!m->data() || !bind_image(m->data(), m->size())) {
+        return false;
+    }
+
+    mapping = std::move(m);
+    return true;
+}
+
+/**
+ * @brief helper for constructor to compile parsed words into an image held in memory, in the same layout as a mapped image
+ * @pre words are all unique, lowercase, and of legal length
+ *
+ * @param words all words to include, in any order
+*/
+void word_dict::compile_words(vector<word_t>&& parsed) {
+    // words numbered in lexicographic order so words sharing a prefix are contiguous
+    std::sort(parsed.begin(), parsed.end(), [](const word_t& lhs, const word_t& rhs) { return lhs.word < rhs.word; });
+    cw_assert_m(parsed.size() < DICT_NO_WORD, "too many words to compile dictionary");
+
+    // build trie breadth first so children of each node are contiguous and in letter order
+    // each pending node covers the words in [lo, hi) sharing its prefix of length depth
+    struct pending_node {
+        uint32_t node;
+        size_t lo;
+        size_t hi;
+        size_t depth;
+    };
+    vector<dict_trie_node> trie = {{0u, 0u, DICT_NO_WORD}};
+    queue<pending_node> pending;
+    pending.push({0u, 0ul, parsed.size(), 0ul});
+    while(!pending.empty()) {
+        pending_node p = pending.front();
+        pending.pop();
+
+        // sorted order places the word equal to this prefix, if any, first
+        if(p.lo < p.hi && parsed[p.lo].word.size() == p.depth) {
+            trie[p.node].word = static_cast<uint32_t>(p.lo);
+            ++p.lo;
+        }
+
+        // one child per distinct next letter
+        trie[p.node].first_child = static_cast<uint32_t>(trie.size());
+        for(size_t i = p.lo, j = p.lo; i < p.hi; i = j) {
+            const char letter = parsed[i].word.at(p.depth);
+            while(j < p.hi && parsed[j].word.at(p.depth) == letter) ++j;
+
+            cw_assert_m(i == p.lo || parsed[i - 1].word != parsed[i].word, "duplicate word in compile_words(): " + parsed[i].word);
+            trie[p.node].child_mask |= 1u << static_cast<uint>(letter - 'a');
+            pending.push({static_cast<uint32_t>(trie.size()), i, j, p.depth + 1});
+            trie.push_back({0u, 0u, DICT_NO_WORD});
+        }
+    }
+
+    // positional inverted index, words visited in id order so every posting list is sorted
+    // first count list sizes, then fill lists in place
+    vector<dict_posting_list> index(DICT_NUM_LISTS, {0u, 0u});
+    for(const word_t& w : parsed) {
+        const uint32_t len = static_cast<uint32_t>(w.word.size());
+        cw_assert_m(len <= MAX_WORD_LEN, "word too long to compile dictionary: " + w.word);
+        index[dict_length_list(len)].count++;
+        for(uint32_t i = 0; i < len; ++i) {
+            index[dict_position_list(len, i, static_cast<uint32_t>(w.word[i] - 'a'))].count++;
+        }
+    }
+    uint32_t num_postings = 0u;
+    for(dict_posting_list& list : index) {
+        list.offset = num_postings;
+        num_postings += list.count;
+    }
+    vector<uint32_t> posting_ids(num_postings);
+    vector<uint32_t> fill(DICT_NUM_LISTS, 0u);
+    auto append = [&](uint32_t list, uint32_t id) { posting_ids[index[list].offset + fill[list]++] = id; };
+    for(uint32_t id = 0; id < static_cast<uint32_t>(parsed.size()); ++id) {
+        const string& w = parsed[id].word;
+        const uint32_t len = static_cast<uint32_t>(w.size());
+        append(dict_length_list(len), id);
+        for(uint32_t i = 0; i < len; ++i) {
+            append(dict_position_list(len, i, static_cast<uint32_t>(w[i] - 'a')), id);
+        }
+    }
+
+    // rank words by descending score, then descending freq, then descending id
+    vector<uint32_t> by_rank(parsed.size());
+    std::iota(by_rank.begin(), by_rank.end(), 0u);
+    std::sort(by_rank.begin(), by_rank.end(), [&parsed](uint32_t lhs, uint32_t rhs) {
+        if(parsed[lhs].score != parsed[rhs].score) return parsed[lhs].score > parsed[rhs].score;
+        if(parsed[lhs].freq != parsed[rhs].freq) return parsed[lhs].freq > parsed[rhs].freq;
+        return lhs > rhs;
+    });
+    vector<uint32_t> ranks(parsed.size());
+    for(uint32_t r = 0; r < static_cast<uint32_t>(by_rank.size()); ++r) {
+        ranks[by_rank[r]] = r;
+    }
+
+    // intern words
+    string interned;
+    vector<dict_word_entry> entries;
+    entries.reserve(parsed.size());
+    for(uint32_t id = 0; id < static_cast<uint32_t>(parsed.size()); ++id) {
+        entries.push_back({
+            .freq = parsed[id].freq,
+            .score = parsed[id].score,
+            .pool_offset = static_cast<uint32_t>(interned.size()),
+            .len = static_cast<uint32_t>(parsed[id].word.size()),
+            .rank = ranks[id]
+        });
+        interned += parsed[id].word;
+    }
+
+    // lay out sections at 8 byte aligned offsets
+    auto align = [](size_t offset) -> size_t { return (offset + 7ul) & ~7ul; };
+    dict_image_header h = {
+        .magic = DICT_IMAGE_MAGIC,
+        .version = DICT_IMAGE_VERSION,
+        .num_words = static_cast<uint32_t>(entries.size()),
+        .num_nodes = static_cast<uint32_t>(trie.size()),
+        .pool_size = static_cast<uint32_t>(interned.size()),
+        .words_offset = 0ul,
+        .nodes_offset = 0ul,
+        .pool_offset = 0ul,
+        .num_postings = num_postings,
+        .padding = 0u,
+        .lists_offset = 0ul,
+        .postings_offset = 0ul
+    };
+    h.words_offset    = align(sizeof(dict_image_header));
+    h.nodes_offset    = align(h.words_offset + entries.size() * sizeof(dict_word_entry));
+    h.lists_offset    = align(h.nodes_offset + trie.size() * sizeof(dict_trie_node));
+    h.postings_offset = align(h.lists_offset + index.size() * sizeof(dict_posting_list));
+    h.pool_offset     = align(h.postings_offset + posting_ids.size() * sizeof(uint32_t));
+    const size_t num_bytes = h.pool_offset + interned.size();
+
+    // uint64_t storage guarantees alignment of every section
+    compiled_image.assign(align(num_bytes) / sizeof(uint64_t), 0ul);
+    std::byte* base = reinterpret_cast<std::byte*>(compiled_image.data());
+    std::memcpy(base, &h, sizeof(h));
+    std::memcpy(base + h.words_offset, entries.data(), entries.size() * sizeof(dict_word_entry));
+    std::memcpy(base + h.nodes_offset, trie.data(), trie.size() * sizeof(dict_trie_node));
+    std::memcpy(base + h.lists_offset, index.data(), index.size() * sizeof(dict_posting_list));
+    std::memcpy(base + h.postings_offset, posting_ids.data(), posting_ids.size() * sizeof(uint32_t));
+    std::memcpy(base + h.pool_offset, interned.data(), interned.size());
+
+    cw_assert(bind_image(base, num_bytes));
+}
+
+/**
+ * @brief helper to validate an image and point views into it
+ *
+ * @param data start of image, 8 byte aligned
+ * @param num_bytes size of image
+ * @return true iff image has the expected magic, version, in-bounds sections and posting lists, and every word id, node index,
+ * and pool range it stores is in bounds
+*/
+bool word_dict::bind_image(const std::byte* data, size_t num_bytes) {
+    if(num_bytes < sizeof(dict_image_header) || reinterpret_cast<uintptr_t>(data) % alignof(dict_image_header) != 0) return false;
+    const dict_image_header* h = reinterpret_cast<const dict_image_header*>(data);
+
+    if(h->magic != DICT_IMAGE_MAGIC || h->version != DICT_IMAGE_VERSION) return false;
+    if(h->num_nodes == 0) return false;
+
+    // every section must be aligned and fit within the image
+    auto section_ok = [num_bytes](uint64_t offset, uint64_t count, uint64_t elem_size) -> bool {
+        return offset % 8 == 0 && offset <= num_bytes && count <= (num_bytes - offset) / elem_size;
+    };
+    if(!section_ok(h->words_offset, h->num_words, sizeof(dict_word_entry))) return false;
+    if(!section_ok(h->nodes_offset, h->num_nodes, sizeof(dict_trie_node)))  return false;
+    if(!section_ok(h->lists_offset, DICT_NUM_LISTS, sizeof(dict_posting_list))) return false;
+    if(!section_ok(h->postings_offset, h->num_postings, sizeof(uint32_t)))  return false;
+    if(!section_ok(h->pool_offset,  h->pool_size, sizeof(char)))            return false;
+
+    // every posting list must fit within postings
+    const dict_posting_list* l = reinterpret_cast<const dict_posting_list*>(data + h->lists_offset);
+    for(uint32_t i = 0; i < DICT_NUM_LISTS; ++i) {
+        if(l[i].offset > h->num_postings || l[i].count > h->num_postings - l[i].offset) return false;
+    }
+
+    // every index stored within a section must be in bounds of the section it refers to, so lookups never need to check
+    const dict_word_entry* w = reinterpret_cast<const dict_word_entry*>(data + h->words_offset);
+    for(uint32_t i = 0; i < h->num_words; ++i) {
+        if(w[i].len > MAX_WORD_LEN || w[i].pool_offset > h->pool_size || w[i].len > h->pool_size - w[i].pool_offset) return false;
+    }
+    const dict_trie_node* n = reinterpret_cast<const dict_trie_node*>(data + h->nodes_offset);
+    for(uint32_t i = 0; i < h->num_nodes; ++i) {
+        if(n[i].child_mask >> NUM_ENGLISH_LETTERS) return false;
+        if(n[i].word != DICT_NO_WORD && n[i].word >= h->num_words) return false;
+        const uint32_t num_children = static_cast<uint32_t>(std::popcount(n[i].child_mask));
+        if(num_children > 0 && (n[i].first_child > h->num_nodes || num_children > h->num_nodes - n[i].first_child)) return false;
+    }
+    const uint32_t* p = reinterpret_cast<const uint32_t*>(data + h->postings_offset);
+    for(uint32_t i = 0; i < h->num_postings; ++i) {
+        if(p[i] >= h->num_words) return false;
+    }
+
+    header = h;
+    words  = w;
+    nodes  = n;
+    lists  = l;
+    postings = p;
+    pool   = reinterpret_cast<const char*>(data + h->pool_offset);
+    return true;
+}
+
+/**
+ * @brief write compiled image of this dictionary to a file, which word_dict can later map instead of parsing
+ *
+ * @param filepath path to write image to, conventionally image_path() of the source file
+*/
+void word_dict::save_image(const std::filesystem::path& filepath) const {
+    std::ofstream image_file(filepath, std::ios::binary | std::ios::trunc);
+    cw_assert_m(image_file.is_open(), "could not open compiled dictionary image for writing " + filepath.string());
+
+    const size_t num_bytes = header->pool_offset + header->pool_size;
+    image_file.write(reinterpret_cast<const char*>(header), static_cast<std::streamsize>(num_bytes));
+    cw_assert_m(image_file.good(), "could not write compiled dictionary image " + filepath.string());
+}
+
+/**
+ * @brief get path of compiled image corresponding to a dictionary file, in the same directory
+ *
+ * @param source path to .txt or .json file
+ * @return source with its extension replaced by DICT_IMAGE_EXTENSION
+*/
+std::filesystem::path word_dict::image_path(const std::filesystem::path& source) {
+    std::filesystem::path image = source;
+    image.replace_extension(DICT_IMAGE_EXTENSION);
+    return image;
+}
+
+/**
+ * @brief get full word struct for an interned word
+ *
+ * @param id index of word in image
+ * @return copy of word with its heuristics
+*/
+word_t word_dict::get_word(word_id_t id) const {
+    cw_assert(id < header->num_words);
+    const dict_word_entry& entry = words[id];
+    return word_t(string(pool + entry.pool_offset, entry.len), entry.score, entry.freq);
+}
+
+/**
+ * @brief get the id of a word
+ *
+ * @param word string to look up
+ * @return id of word, or nullopt if word is not in this dictionary
+*/
+optional<word_id_t> word_dict::find_id(const string& word) const {
+    uint32_t node_idx = 0u;
+    for(char c : word) {
+        if(c < 'a' || c > 'z') return std::nullopt;
+
+        const uint32_t bit = 1u << static_cast<uint>(c - 'a');
+        const dict_trie_node& node = nodes[node_idx];
+        if(!(node.child_mask & bit)) return std::nullopt;
+        node_idx = node.first_child + static_cast<uint32_t>(std::popcount(node.child_mask & (bit - 1u)));
+    }
+    if(nodes[node_idx].word == DICT_NO_WORD) return std::nullopt;
+    return nodes[node_idx].word;
+}
+
+/**
+ * @brief find all words that match a pattern with WILDCARD ('?') as placeholder
+ *
+ * @param pattern the pattern to compare against
+ * @return set of all matching words
+*/
+unordered_set<word_t> word_dict::find_matches(const string& pattern) const {
+    unordered_set<word_t> matches;
+    for(const word_id_t id : find_match_ids(pattern)) {
+        matches.insert(get_word(id));
+    }
+    return matches;
+}
+
+/**
+ * @brief find ids of all words that match a pattern with WILDCARD ('?') as placeholder
+ * @note intersects the posting lists of every fixed letter in pattern, smallest first
+ *
+ * @param pattern the pattern to compare against
+ * @return ids of all matching words in increasing, i.e. lexicographic, order
+*/
+vector<word_id_t> word_dict::find_match_ids(const string& pattern) const {
+    vector<word_id_t> matches;
+    if(pattern.empty() || pattern.size() > MAX_WORD_LEN) return matches;
+    const uint32_t len = static_cast<uint32_t>(pattern.size());
+
+    // posting list of each fixed letter in pattern
+    vector<std::span<const uint32_t> > fixed;
+    for(uint32_t i = 0; i < len; ++i) {
+        if(pattern[i] == WILDCARD) continue;
+        if(pattern[i] < 'a' || pattern[i] > 'z') return matches;
+        fixed.push_back(posting_list(dict_position_list(len, i, static_cast<uint32_t>(pattern[i] - 'a'))));
+    }
+
+    // no fixed letters, every word of this length matches
+    if(fixed.empty()) {
+        const std::span<const uint32_t> all = posting_list(dict_length_list(len));
+        return vector<word_id_t>(all.begin(), all.end());
+    }
+
+    // keep ids of smallest list found in every other list, searching each list only past the last id found in it
+    std::sort(fixed.begin(), fixed.end(), [](const auto& lhs, const auto& rhs) { return lhs.size() < rhs.size(); });
+    vector<const uint32_t*> cursors;
+    for(const std::span<const uint32_t>& list : fixed) {
+        cursors.push_back(list.data());
+    }
+    matches.reserve(fixed.front().size());
+    for(const uint32_t id : fixed.front()) {
+        bool found = true;
+        for(size_t k = 1; k < fixed.size() && found; ++k) {
+            cursors[k] = std::lower_bound(cursors[k], fixed[k].data() + fixed[k].size(), id);
+            found = cursors[k] != fixed[k].data() + fixed[k].size() && *cursors[k] == id;
+        }
+        if(found) matches.push_back(id);
+    }
+
+    return matches;
+}
+
+/**
+ * @brief read all words from a dictionary file
+ *
+ * @param filepath path to .txt or .json file containing word data
+ * @param print_progress_bar displays progress bar iff true, default: false
+ * @return all valid words of legal length, duplicates after parsing keep their first occurrence
+*/
+vector<word_t> word_dict::read_words(const std::filesystem::path& filepath, bool print_progress_bar) {
+    cw_utils utils("word_dict read_words()", VERBOSITY);
+    vector<word_t> result;
+    unordered_set<string> seen;
+    string word;
+    optional<string> parsed_word;
+    unique_ptr<progress_bar> bar = nullptr;
+
+    // keep first occurrence of each word
+    auto add_word = [&result, &seen](word_t&& w) {
+        if(w.word.size() >= MIN_WORD_LEN && w.word.size() <= MAX_WORD_LEN && seen.insert(w.word).second) {
+            result.push_back(std::move(w));
+        }
+    };
+
+    if(has_suffix(static_cast<string>(filepath), ".txt")) {
+        // open file
+        ifstream word_file;
+        word_file.open(filepath);
+        cw_assert_m(word_file.is_open(), "could not open txt file " + static_cast<string>(filepath));
+
+        // count total number of lines in file for progress bar
+        uint num_lines = 0;
+        if(print_progress_bar) {
+            while(getline(word_file, word)) num_lines++;
+            word_file.clear(); // clear EOF flag
+            word_file.seekg(0, std::ios::beg); // rewind file indicator
+        }
+
+        // create progress bar, now that denominator (num_lines) is known
+        if(print_progress_bar) {
+            bar = make_unique<progress_bar>(utils, num_lines, 0.01, PROGRESS_BAR_WIDTH, "Building", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
+        }
+
+        // parse word file
+        while(getline(word_file, word)) {
+            // check for validity & convert uppercase, remove dashes, etc.
+            parsed_word = parse_word(word);
+
+            // add if valid and of valid size
+            if(parsed_word.has_value()) {
+                add_word(word_t(parsed_word.value()));
+            }
+
+            // another word added
+            if(bar) bar->incr_numerator();
+        }
+        word_file.close();
+
+    } else if(has_suffix(static_cast<string>(filepath), ".json")) {
+        // open word file, parse data
+        ifstream word_file(filepath);
+        cw_assert_m(word_file.is_open(), "could not open json file " + static_cast<string>(filepath));
+        basic_json j = basic_json::parse(word_file);
+
+        // create progress bar, now that denominator (j.size()) is known
+        if(print_progress_bar) {
+            bar = make_unique<progress_bar>(utils, j.size(), 0.01, PROGRESS_BAR_WIDTH, "Building", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
+        }
+
+        for(const auto& [item, data] : j.items()) {
+            // incoming json is guarenteed to be clean, besides for word length (all lowercase and alphabetical)
+            parsed_word = parse_word(item);
+            cw_assert_m(parsed_word.has_value() && parsed_word.value() == item, ".json file input word not clean: " + item);
+
+            // add word
+            add_word(word_t(item, data["Score"], data["Frequency"]));
+
+            // another word added
+            if(bar) bar->incr_numerator();
+        }
+        word_file.close();
+
+    } else {
+        utils.log(FATAL, "word_dict got file of invalid type: ", static_cast<string>(filepath));
+    }
+
+    return result;
+}
+
+/**
+ * @brief helper for read_words() to detect file type
+ *
+ * @param str string to check the suffix of
+ * @param suffix the suffix to check for
+ * @return true iff str ends with suffix
+*/
+bool word_dict::has_suffix(const string& str, const string& suffix) {
+    if(str.size() < suffix.size()) return false;
+    return str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * @brief helper for read_words() to test validity for and parse words
+ *
+ * @param word the word to test
+ * @return optional containing word iff word only contains lowercase letters, uppercase letters, dashes, apostrophes, semicolons, numbers, spaces
+*/
+optional<string> word_dict::parse_word(const string& word) {
+    stringstream word_ss;
+    for(char c : word) {
+        if(c >= 'a' && c <= 'z') {
+            // valid lowercase letters, do nothing
+            word_ss << c;
+        } else if(c >= 'A' && c <= 'Z') {
+            // valid uppercase letters, convert to lowercase
+            word_ss << static_cast<char>(c + 'a' - 'A');
+        } else if(c == '-' || c == '\'' || c == ' ' || c == ';' || (c >= '0' && c <= '9')) {
+            // remove dashes/apostrophes/semicolons/numbers/spaces, do nothing
+        } else {
+            // invalid word, contains unknown character
+            return std::nullopt;
+        }
+    }
+    return std::make_optional<string>(word_ss.str());
+}
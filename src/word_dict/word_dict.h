@@ -0,0 +1,132 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: class declaration for immutable word dictionary shared by all cw_csp
+// ==================================================================
+
+#ifndef WORD_DICT_H
+#define WORD_DICT_H
+
+#include "../common/common_data_types.h"
+#include "../utils/cw_utils.h"
+#include "../common/common_parent.h"
+#include "word_dict_data_types.h"
+
+using namespace common_data_types_ns;
+using namespace cw;
+using namespace common_parent_ns;
+using namespace word_dict_data_types_ns;
+
+namespace word_dict_ns {
+    /**
+     * @brief class representation of all valid words of all lengths read from a dictionary file
+     * @note immutable once constructed, so a single copy may be read by any number of cw_csp and threads at once
+     * @note contents are always held in compiled image layout, either mapped from a .cwdict file or compiled in memory
+    */
+    class word_dict : public common_parent {
+        public:
+            // get the process-wide copy of a dictionary, parsing the file only upon the first request for it
+            static shared_ptr<const word_dict> load(const std::filesystem::path& filepath, bool print_progress_bar = false);
+
+            // base constructor, maps compiled image if a fresh one exists, otherwise parses file. prefer load() to share one copy per process
+            word_dict(const string& name, const std::filesystem::path& filepath, bool print_progress_bar);
+
+            // constructor with words already parsed, compiled in memory. for tables of words not read from a file
+            word_dict(const string& name, vector<word_t>&& words);
+
+            // read all valid, unique words from a .txt or .json dictionary file in file order
+            static vector<word_t> read_words(const std::filesystem::path& filepath, bool print_progress_bar = false);
+
+            // path of compiled image corresponding to a .txt or .json dictionary file
+            static std::filesystem::path image_path(const std::filesystem::path& source);
+
+            // write compiled image of this dictionary, for cw_dictc
+            void save_image(const std::filesystem::path& filepath) const;
+
+            // word check
+            bool is_word(const string& word) const { return find_id(word).has_value(); }
+
+            // get id of a word, if in dictionary
+            optional<word_id_t> find_id(const string& word) const;
+
+            // find ids of all words that match a pattern, in increasing order
+            vector<word_id_t> find_match_ids(const string& pattern) const;
+
+            // find all words that match a pattern
+            unordered_set<word_t> find_matches(const string& pattern) const;
+
+            // number of words in dictionary
+            size_t size() const { return header->num_words; }
+
+            // file this dictionary was read from
+            const std::filesystem::path& filepath() const { return path; }
+
+            // get full word struct for an interned word, ids are dense in [0, size()) and in lexicographic order
+            word_t get_word(word_id_t id) const;
+
+            // get contents of an interned word without copying
+            string_view get_str(word_id_t id) const {
+                cw_assert(id < header->num_words);
+                return string_view(pool + words[id].pool_offset, words[id].len);
+            }
+
+            // get heuristics of an interned word
+            int  get_score(word_id_t id) const { cw_assert(id < header->num_words); return words[id].score; }
+            long get_freq(word_id_t id)  const { cw_assert(id < header->num_words); return words[id].freq;  }
+
+            // get position of an interned word when all words are ordered by descending score, then descending freq, then descending id
+            uint32_t get_rank(word_id_t id) const { cw_assert(id < header->num_words); return words[id].rank; }
+
+            // true iff contents are mapped from a compiled image rather than parsed
+            bool is_mapped() const { return mapping != nullptr; }
+
+            // copy/move disallowed, shared by ptr from load()
+            word_dict(const word_dict& other) = delete;
+            word_dict& operator=(const word_dict& other) = delete;
+            word_dict(word_dict&& other) = delete;
+            word_dict& operator=(word_dict&& other) = delete;
+
+            // default ok
+            ~word_dict() = default;
+
+        private:
+            // file this dictionary was read from
+            std::filesystem::path path;
+
+            // image compiled in memory from a .txt or .json file, empty if mapped
+            vector<uint64_t> compiled_image;
+
+            // mapped compiled image, null if compiled in memory
+            unique_ptr<mapped_file> mapping;
+
+            // views into whichever image backs this dictionary, never modified after construction
+            const dict_image_header* header;
+            const dict_word_entry* words;
+            const dict_trie_node* nodes;
+            const dict_posting_list* lists;
+            const uint32_t* postings;
+            const char* pool;
+
+            // protects cache, held for the duration of parsing so each file is parsed at most once
+            static mutex cache_mx;
+
+            // all dictionaries loaded so far, keyed by canonical filepath
+            static unordered_map<string, shared_ptr<const word_dict> > cache;
+
+            // helpers for constructor to get an image from each possible source
+            bool try_map_image(const std::filesystem::path& image);
+            void compile_words(vector<word_t>&& words);
+
+            // helper for find_match_ids() to get a posting list as a range of word ids
+            std::span<const uint32_t> posting_list(uint32_t list) const { return {postings + lists[list].offset, lists[list].count}; }
+
+            // helper to point header/words/nodes/lists/postings/pool at an image, returns false if image is malformed
+            bool bind_image(const std::byte* data, size_t num_bytes);
+
+            // helpers for read_words() to detect file type and to check if word is legal
+            static bool has_suffix(const string& str, const string& suffix);
+            static optional<string> parse_word(const string& word);
+    }; // word_dict
+}; // word_dict_ns
+
+#endif // WORD_DICT_H
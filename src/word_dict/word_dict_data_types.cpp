@@ -0,0 +1,43 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: data type implementations for compiled dictionary images and read-only file mappings
+// ==================================================================
+
+#include "word_dict_data_types.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace word_dict_data_types_ns;
+
+/**
+ * @brief map entire file read-only, leaving this unmapped if the file cannot be opened or is empty
+ *
+ * @param filepath path of file to map
+*/
+mapped_file::mapped_file(const std::filesystem::path& filepath) : addr(nullptr), len(0ul) {
+    const int fd = open(filepath.c_str(), O_RDONLY);
+    if(fd < 0) return;
+
+    struct stat st;
+    if(fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping != MAP_FAILED) {
+            addr = mapping;
+            len = static_cast<size_t>(st.st_size);
+        }
+    }
+
+    // mapping stays valid after fd is closed
+    close(fd);
+}
+
+/**
+ * @brief unmap file, if mapped
+*/
+mapped_file::~mapped_file() {
+    if(addr) munmap(addr, len);
+}
@@ -0,0 +1,148 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: data types for compiled dictionary images and read-only file mappings
+// ==================================================================
+
+#ifndef WORD_DICT_DATA_TYPES_H
+#define WORD_DICT_DATA_TYPES_H
+
+#include "../common/common_data_types.h"
+#include "../utils/cw_utils.h"
+
+using namespace common_data_types_ns;
+using namespace cw;
+
+namespace word_dict_data_types_ns {
+    /**
+     * @brief layout of a compiled dictionary image, as written by cw_dictc and read by word_dict
+     *
+     * [dict_image_header][dict_word_entry x num_words][dict_trie_node x num_nodes]
+     * [dict_posting_list x DICT_NUM_LISTS][uint32_t x num_postings][char x pool_size]
+     *
+     * all sections start at 8 byte aligned offsets from the start of the image, and all words are
+     * numbered in lexicographic order. words are interned in pool, without null terminators. each word
+     * also stores its rank, i.e. its position when all words are ordered by descending score, then descending
+     * freq, then descending id, so candidates can be ordered for search without comparing heuristics
+     *
+     * postings is a positional inverted index partitioned by length: for each length, the ids of all words 
+     * of that length, and for each (length, index, letter), the ids of words of that length with that letter 
+     * at that index. every list is sorted by id, so pattern queries intersect the lists of their fixed letters
+    */
+
+    // magic string identifying a compiled dictionary image
+    static constexpr array<char, 8> DICT_IMAGE_MAGIC = {'C', 'W', 'D', 'I', 'C', 'T', '\0', '\0'};
+
+    // bump whenever layout of any struct below changes, images of other versions are ignored
+    static constexpr uint32_t DICT_IMAGE_VERSION = 3u;
+
+    // file extension for compiled dictionary images
+    static constexpr string_view DICT_IMAGE_EXTENSION = ".cwdict";
+
+    // placeholder for trie nodes that do not terminate a word
+    static constexpr uint32_t DICT_NO_WORD = UINT32_MAX;
+
+    // number of posting lists of all words of a length, one per length in [0, MAX_WORD_LEN]
+    static constexpr uint32_t DICT_NUM_LENGTH_LISTS = MAX_WORD_LEN + 1;
+
+    // number of posting lists of words with a letter at an index, one per (length, index < length, letter)
+    static constexpr uint32_t DICT_NUM_POSITION_LISTS = NUM_ENGLISH_LETTERS * MAX_WORD_LEN * (MAX_WORD_LEN + 1) / 2;
+
+    // total number of posting lists, length lists first
+    static constexpr uint32_t DICT_NUM_LISTS = DICT_NUM_LENGTH_LISTS + DICT_NUM_POSITION_LISTS;
+
+    // index of the posting list of words of length len
+    constexpr uint32_t dict_length_list(uint32_t len) {
+        return len;
+    }
+
+    // index of the posting list of words of length len with letter at index
+    constexpr uint32_t dict_position_list(uint32_t len, uint32_t index, uint32_t letter) {
+        return DICT_NUM_LENGTH_LISTS + NUM_ENGLISH_LETTERS * (len * (len - 1) / 2 + index) + letter;
+    }
+
+    /**
+     * @brief start of every compiled dictionary image
+    */
+    struct dict_image_header {
+        array<char, 8> magic;  // must equal DICT_IMAGE_MAGIC
+        uint32_t version;      // must equal DICT_IMAGE_VERSION
+        uint32_t num_words;    // number of dict_word_entry
+        uint32_t num_nodes;    // number of dict_trie_node, root node is always index 0
+        uint32_t pool_size;    // number of chars in the string pool
+        uint64_t words_offset; // byte offset of first dict_word_entry
+        uint64_t nodes_offset; // byte offset of first dict_trie_node
+        uint64_t pool_offset;  // byte offset of string pool
+        uint32_t num_postings; // number of word ids in all posting lists
+        uint32_t padding;      // explicitly zeroed for reproducible images
+        uint64_t lists_offset; // byte offset of first dict_posting_list
+        uint64_t postings_offset; // byte offset of first word id of first posting list
+    };
+
+    /**
+     * @brief one interned word and its heuristics
+    */
+    struct dict_word_entry {
+        int64_t freq;         // word_t::freq
+        int32_t score;        // word_t::score
+        uint32_t pool_offset; // offset of first char of word in string pool
+        uint32_t len;         // number of chars in word
+        uint32_t rank;        // position of word when all words ordered by descending score, then descending freq, then descending id
+    };
+
+    /**
+     * @brief node of the prebuilt trie over all words, children of each node are contiguous and in letter order
+    */
+    struct dict_trie_node {
+        uint32_t child_mask;  // bit i set iff child with letter 'a' + i exists
+        uint32_t first_child; // index of child with lowest letter, meaningless if child_mask is 0
+        uint32_t word;        // id of word terminating at this node, or DICT_NO_WORD
+    };
+
+    /**
+     * @brief range of the postings section holding one posting list
+    */
+    struct dict_posting_list {
+        uint32_t offset; // index of first word id of list in postings
+        uint32_t count;  // number of word ids in list
+    };
+
+    // all section structs are copied as raw bytes
+    static_assert(std::is_trivially_copyable_v<dict_image_header>);
+    static_assert(std::is_trivially_copyable_v<dict_word_entry>);
+    static_assert(std::is_trivially_copyable_v<dict_trie_node>);
+    static_assert(std::is_trivially_copyable_v<dict_posting_list>);
+    static_assert(sizeof(dict_word_entry) % 8 == 0);
+    static_assert(dict_position_list(MAX_WORD_LEN, MAX_WORD_LEN - 1, NUM_ENGLISH_LETTERS - 1) == DICT_NUM_LISTS - 1);
+
+    /**
+     * @brief RAII read-only memory mapping of an entire file
+    */
+    class mapped_file {
+        public:
+            // maps filepath, data() is null if the file could not be mapped
+            explicit mapped_file(const std::filesystem::path& filepath);
+
+            // start of mapped contents, or null if not mapped
+            const std::byte* data() const { return static_cast<const std::byte*>(addr); }
+
+            // size of mapped contents in bytes
+            size_t size() const { return len; }
+
+            // copy disallowed, would double unmap
+            mapped_file(const mapped_file& other) = delete;
+            mapped_file& operator=(const mapped_file& other) = delete;
+
+            // unmaps file
+            ~mapped_file();
+
+        private:
+            // start of mapping, or null
+            void* addr;
+
+            // length of mapping
+            size_t len;
+    }; // mapped_file
+}; // word_dict_data_types_ns
+
+#endif // WORD_DICT_DATA_TYPES_H
@@ -21,7 +21,7 @@ word_domain::word_domain(string name) : word_domain(name, std::nullopt) {
  * @brief constructor for word_domain with filepath
  * 
  * @param name the name of this object
- * @param filepath path to .txt or .json file containing word data
+ * @param filepath path to .txt, .json, or compiled .cwdict file containing word data
  * @param print_progress_bar displays progress bar iff true, default: false
 */
 word_domain::word_domain(string name, const std::filesystem::path& filepath, bool print_progress_bar)
@@ -33,223 +33,321 @@ word_domain::word_domain(string name, const std::filesystem::path& filepath, boo
  * @brief constructor for word_domain with filepath optional
  * 
  * @param name the name of this object
- * @param filepath_opt optional, may contain path to .txt or .json file containing word data
+ * @param filepath_opt optional, may contain path to .txt, .json, or compiled .cwdict file containing word data
  * @param print_progress_bar displays progress bar iff true, default: false
 */
 word_domain::word_domain(string name, const optional<std::filesystem::path>& filepath_opt, bool print_progress_bar)
         : common_parent(name, VERBOSITY),
         filepath_opt(filepath_opt),
+        backend(word_domain_backend::TRIE),
         unassigned_domain_size(0),
-        letters_at_indices(make_unique<letter_idx_table<letters_table_entry> >()),
         assigned(false) {
-    // init root node of trie
-    nodes.push_back(
-        make_unique<trie_node>(TRIE_ROOT_NODE_IDX, false, '_', id_obj_manager<trie_node>::INVALID_ID)
-    );
-
-    // if filepath was provided
+    // if filepath was provided, intern words in the process-wide word_dict so a compiled image is mapped instead of parsed when available
     if(filepath_opt.has_value()) {
-        std::filesystem::path filepath = filepath_opt.value();
-        string word;
-        optional<string> parsed_word;
-        unique_ptr<progress_bar> bar = nullptr;
-
-        if(has_suffix(static_cast<string>(filepath), ".txt")) {
-            // open file
-            ifstream word_file;
-            word_file.open(filepath);
-            cw_assert_m(word_file.is_open(), "could not open txt file " + static_cast<string>(filepath));
-
-            // count total number of lines in file for progress bar
-            uint num_lines = 0;
-            if(print_progress_bar) {
-                while(getline(word_file, word)) num_lines++;
-                word_file.clear(); // clear EOF flag
-                word_file.seekg(0, std::ios::beg); // rewind file indicator
-            }
-            
-            // create progress bar, now that denominator (num_lines) is known
-            if(print_progress_bar) {
-                bar = make_unique<progress_bar>(utils, num_lines, 0.01, PROGRESS_BAR_WIDTH, "Building", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
-            }
-
-            // parse word file
-            while(getline(word_file, word)) {
-                // check for validity & convert uppercase, remove dashes, etc.
-                parsed_word = parse_word(word);
-
-                // add to word set & tree if valid and of valid size
-                if(parsed_word.has_value()) {
-                    word = parsed_word.value();
-                    
-                    if(word.size() >= MIN_WORD_LEN && word.size() <= MAX_WORD_LEN) {
-                        add_word(word_t(word));
-                    } 
-                }
-
-                // another word added
-                if(bar) bar->incr_numerator();
-            }
-            word_file.close();
-
-        } else if(has_suffix(static_cast<string>(filepath), ".json")) {
-            // open word file, parse data
-            ifstream word_file(filepath);
-            cw_assert_m(word_file.is_open(), "could not open json file " + static_cast<string>(filepath));
-            basic_json j = basic_json::parse(word_file);
-            
-            // create progress bar, now that denominator (j.size()) is known
-            if(print_progress_bar) {
-                bar = make_unique<progress_bar>(utils, j.size(), 0.01, PROGRESS_BAR_WIDTH, "Building", PROGRESS_BAR_SYMBOL_FULL, PROGRESS_BAR_SYMBOL_EMPTY);
-            }
-
-            for(const auto& [item, data] : j.items()) {
-                // incoming json is guarenteed to be clean, besides for word length (all lowercase and alphabetical)
-                parsed_word = parse_word(item);
-                cw_assert_m(parsed_word.has_value() && parsed_word.value() == item, ".json file input word not clean: " + item);
-                word = item;
-
-                // add word
-                if(word.size() >= MIN_WORD_LEN && word.size() <= MAX_WORD_LEN) {
-                    add_word(word_t(word, data["Score"], data["Frequency"]));
-                }
-
-                // another word added
-                if(bar) bar->incr_numerator();
-            }
-            word_file.close();
-
-        } else {
-            utils.log(FATAL, "word_domain got file of invalid type: ", static_cast<string>(filepath));
-            return;
-        }
+        table = word_dict::load(filepath_opt.value(), print_progress_bar);
+        words.resize(table->size());
+        std::iota(words.begin(), words.end(), 0u);
+    } else {
+        table = make_shared<const word_dict>(name + " table", vector<word_t>());
     }
+
+    // build trie once all words known
+    build_domain();
 }
 
 /**
- * @brief constructor for word_domain with hashset of words in domain
+ * @brief constructor for word_domain with hashset of words in domain, interned in a table private to this domain
  * @warning behavior undefined unless called to initialize a domain for a cw_variable
  * 
  * @param name the name of this object
  * @param domain set of words to add to domain, whose words must all be equal length
+ * @param backend data structure to track remaining words with, default: DEFAULT_WORD_DOMAIN_BACKEND
 */
-word_domain::word_domain(string name, unordered_set<word_t>&& domain)
+word_domain::word_domain(string name, unordered_set<word_t>&& domain, word_domain_backend backend)
         : common_parent(name, VERBOSITY),
           filepath_opt(std::nullopt),
+          backend(backend),
           unassigned_domain_size(0),
-          letters_at_indices(make_unique<letter_idx_table<letters_table_entry> >()),
           assigned(false) {
-    // init root node of trie
-    nodes.push_back(
-        make_unique<trie_node>(TRIE_ROOT_NODE_IDX, false, '_', id_obj_manager<trie_node>::INVALID_ID)
-    );
-
     size_t word_len = 0;
-    for(word_t word : domain) {
+    for(const word_t& word : domain) {
         cw_assert_m(word_len == 0 || word_len == word.word.size(), "word_domain set constructor includes words of unequal length");
         word_len = word.word.size();
-        add_word(word);
     }
-}
+    table = make_shared<const word_dict>(name + " table", vector<word_t>());
+    insert_words(vector<word_t>(domain.begin(), domain.end()));
 
-/**
- * @brief helper for filepath constructor to detect file type
- * 
- * @param str string to check the suffix of
- * @param suffix the suffix to check for
- * @return true iff str ends with suffix
-*/
-bool word_domain::has_suffix(const string& str, const string& suffix) {
-    if(str.size() < suffix.size()) return false;
-    return str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    // build domain once all words known
+    build_domain();
 }
 
 /**
- * @brief helper for filepath constructor to test validity for and parse words
+ * @brief constructor for word_domain with ids of words interned in a table shared with other domains
+ * @warning behavior undefined unless called to initialize a domain for a cw_variable
  * 
- * @param word the word to test
- * @return optional containing word iff word only contains lowercase letters, uppercase letters, dashes, apostrophes, semicolons, numbers, spaces
-*/
-optional<string> word_domain::parse_word(const string& word) {
-    stringstream word_ss;
-    for(char c : word) {
-        if(c >= 'a' && c <= 'z') {
-            // valid lowercase letters, do nothing
-            word_ss << c;
-        } else if(c >= 'A' && c <= 'Z') {
-            // valid uppercase letters, convert to lowercase
-            word_ss << static_cast<char>(c + 'a' - 'A');
-        } else if(c == '-' || c == '\'' || c == ' ' || c == ';' || (c >= '0' && c <= '9')) {
-            // remove dashes/apostrophes/semicolons/numbers/spaces, do nothing
-        } else {
-            // invalid word, contains unknown character
-            return std::nullopt;
-        }
+ * @param name the name of this object
+ * @param table interned words, i.e. the dictionary shared by all variables of a cw_csp
+ * @param domain ids in table of words to add to domain, whose words must all be equal length
+ * @param backend data structure to track remaining words with, default: DEFAULT_WORD_DOMAIN_BACKEND
+*/
+word_domain::word_domain(string name, shared_ptr<const word_dict> table, vector<word_id_t>&& domain, word_domain_backend backend)
+        : common_parent(name, VERBOSITY),
+          filepath_opt(std::nullopt),
+          backend(backend),
+          table(std::move(table)),
+          words(std::move(domain)),
+          unassigned_domain_size(0),
+          assigned(false) {
+    cw_assert(this->table);
+
+    // ids numbered in lexicographic order, so sorting ids sorts words
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    for(const word_id_t id : words) {
+        cw_assert_m(words.empty() || this->table->get_str(id).size() == this->table->get_str(words.front()).size(), 
+                    "word_domain id constructor includes words of unequal length");
     }
-    return std::make_optional<string>(word_ss.str());
+
+    // build domain once all words known
+    build_domain();
 }
 
 /**
  * @brief adds word to word tree, updates letters_at_indices
+ * @note rebuilds trie in time linear in domain size, use add_words() to add many words at once
  * 
  * @param word the word to add, duplicates do nothing
  * @note if domain assigned, this will overwrite the domain value
 */
 void word_domain::add_word(word_t w) {
+    add_words({std::move(w)});
+}
+
+/**
+ * @brief adds words to word tree, updates letters_at_indices, rebuilding trie at most once
+ * 
+ * @param new_words the words to add, duplicates do nothing
+ * @note if domain assigned, this will overwrite the domain value with the last word
+*/
+void word_domain::add_words(const vector<word_t>& new_words) {
     if(assigned) {
-        assigned_value = w;
+        if(!new_words.empty()) assigned_value = intern(new_words.back());
 
         // letters_at_indices not updated since it's contents are undefined if assigned
-    } else {
-        if(word_map.count(w.word) == 0) {
+    } else if(insert_words(new_words)) {
+        build_domain();
+    }
+}
+
+/**
+ * @brief helper to get the id of a word in table, interning it in a private copy of table if absent
+ * @pre word absent from table -> no AC-3 call in progress
+ * 
+ * @param w the word to get the id of
+ * @return id of w in table
+*/
+word_id_t word_domain::intern(const word_t& w) {
+    optional<word_id_t> id = table->find_id(w.word);
+    if(!id.has_value()) {
+        extend_table({w});
+        id = table->find_id(w.word);
+        cw_assert(id.has_value());
+    }
+    return id.value();
+}
+
+/**
+ * @brief helper to add words to words without updating trie or letters_at_indices
+ * @pre some word absent from table -> no AC-3 call in progress
+ * 
+ * @param new_words the words to add
+ * @return true iff any word was not yet in words
+*/
+bool word_domain::insert_words(const vector<word_t>& new_words) {
+    // intern words absent from table all at once, since each extension copies table
+    vector<word_t> absent;
+    unordered_set<string> seen;
+    for(const word_t& w : new_words) {
+        if(!table->find_id(w.word).has_value() && seen.insert(w.word).second) {
+            absent.push_back(w);
+        }
+    }
+    if(!absent.empty()) extend_table(absent);
+
+    // merge ids of new words into words, which stays sorted
+    vector<word_id_t> ids;
+    ids.reserve(new_words.size());
+    for(const word_t& w : new_words) {
+        ids.push_back(table->find_id(w.word).value());
+    }
+    std::sort(ids.begin(), ids.end());
+
+    const size_t prev_size = words.size();
+    vector<word_id_t> merged;
+    merged.reserve(words.size() + ids.size());
+    std::set_union(words.begin(), words.end(), ids.begin(), ids.end(), std::back_inserter(merged));
+    merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+    words = std::move(merged);
+    return words.size() > prev_size;
+}
+
+/**
+ * @brief helper to replace table with a private copy of itself which also includes absent words, and remap every id held to the new table
+ * @pre no AC-3 call in progress, since the ids in ac3_pruned_assigned_val would not be remapped
+ * @note ids are in lexicographic order in both tables, so words stays sorted, ranks of words keep their relative order, 
+ *       and the trie and bitmaps stay valid
+ * 
+ * @param absent words to add to table, none of which may already be in it
+*/
+void word_domain::extend_table(const vector<word_t>& absent) {
+    cw_assert_m(ac3_pruned_assigned_val.empty(), "word_domain table extended during AC-3 call");
+
+    vector<word_t> all_words;
+    all_words.reserve(table->size() + absent.size());
+    for(word_id_t id = 0u; id < static_cast<word_id_t>(table->size()); ++id) {
+        all_words.push_back(table->get_word(id));
+    }
+    for(const word_t& w : absent) {
+        for(char c : w.word) {
+            cw_assert('a' <= c && c <= 'z');
+        }
+        cw_assert(w.word.size() <= MAX_WORD_LEN);
+        all_words.push_back(w);
+    }
+
+    shared_ptr<const word_dict> extended = make_shared<const word_dict>(name + " table", std::move(all_words));
+    auto remap = [this, &extended](word_id_t id) -> word_id_t {
+        return extended->find_id(string(table->get_str(id))).value();
+    };
+    for(word_id_t& id : words) {
+        id = remap(id);
+    }
+    if(assigned_value.has_value()) {
+        assigned_value = remap(assigned_value.value());
+    }
+    table = std::move(extended);
+}
+
+/**
+ * @brief helper to rebuild the backend of this domain from scratch given all words in words
+ * @pre no AC-3 call in progress, i.e. no words pruned
+*/
+void word_domain::build_domain() {
+    cw_assert_m(ac3_pruned_assigned_val.empty(), "word_domain rebuilt during AC-3 call");
 
-            word_map.insert({w.word, w});
-            unassigned_domain_size++;
+    // words numbered in lexicographic order so words sharing a prefix are contiguous
+    cw_assert(std::is_sorted(words.begin(), words.end()));
+    unassigned_domain_size = words.size();
 
-            // update word counts in letters_at_indices
-            for(uint i = 0; i < w.word.size(); ++i) {
-                cw_assert('a' <= w.word.at(i) && w.word.at(i) <= 'z');
-                (*letters_at_indices)[i][static_cast<size_t>(w.word.at(i) - 'a')].num_words++;
+    switch(backend) {
+        case word_domain_backend::TRIE:   build_trie();    break;
+        case word_domain_backend::BITSET: build_bitmaps(); break;
+    }
+}
+
+/**
+ * @brief helper for build_domain() to rebuild trie and letters_at_indices from words
+*/
+void word_domain::build_trie() {
+    // letters_at_indices and lai_subsets only sized for indices that some word reaches
+    size_t word_len = 0;
+    for(const word_id_t id : words) {
+        word_len = std::max(word_len, table->get_str(id).size());
+    }
+    letters_at_indices.assign(word_len, {});
+    for(auto& row : letters_at_indices) {
+        row.fill(letters_table_entry(word_len));
+    }
+
+    // every word counted in letters_at_indices and lai_subsets
+    for(const word_id_t id : words) {
+        const string_view w = table->get_str(id);
+        for(size_t i = 0; i < w.size(); ++i) {
+            letters_table_entry& entry = letters_at_indices[i][static_cast<size_t>(w[i] - 'a')];
+            entry.num_words++;
+            for(size_t j = 0; j < w.size(); ++j) {
+                entry.lai_subset[letters_table_entry::lai_index(j, static_cast<size_t>(w[j] - 'a'))]++;
             }
+        }
+    }
+    letters_present.assign(word_len, letter_bitset_t());
+    for(size_t i = 0; i < word_len; ++i) {
+        for(size_t j = 0; j < NUM_ENGLISH_LETTERS; ++j) {
+            letters_present[i][j] = letters_at_indices[i][j].num_words > 0;
+        }
+    }
 
-            /**
-             * @brief private helper for add_word(), adds word to trie
-             * 
-             * @param node_idx idx in nodes id_obj_manager of node to branch off of, if applicable
-             * @param word the word to add
-             * @param pos index of next letter to add to tree
-            */
-            std::function<void(const size_t, const string&, uint pos)> add_word_to_trie;
-            add_word_to_trie = [this, &add_word_to_trie](const size_t node_idx, const string& word, uint pos) {
-                cw_assert(node_idx < nodes.size());
-
-                // all letters added to tree
-                if(pos >= word.size()) {
-                    // mark node as terminating valid word
-                    nodes[node_idx]->valid = true;
-
-                    // update word counts in lai_subsets
-                    cw_assert(update_lai_subsets<true, false>(node_idx) == word.size());
-                    return;
-                }
+    // build trie breadth first so each depth, and the children of each node, are contiguous
+    // each pending node covers the words in [lo, hi) sharing its prefix of length depth
+    struct pending_node {
+        uint32_t node;
+        size_t lo;
+        size_t hi;
+        size_t depth;
+    };
+    nodes.clear();
+    nodes.push_back(TRIE_NO_ID, '_');
+    queue<pending_node> pending;
+    pending.push({TRIE_ROOT_NODE_IDX, 0ul, words.size(), 0ul});
+    while(!pending.empty()) {
+        pending_node p = pending.front();
+        pending.pop();
+
+        // sorted order places the word equal to this prefix, if any, first
+        if(p.lo < p.hi && table->get_str(words[p.lo]).size() == p.depth) {
+            nodes.word[p.node] = static_cast<uint32_t>(p.lo);
+            ++p.lo;
+        }
+
+        // one child per distinct next letter
+        nodes.first_child[p.node] = static_cast<uint32_t>(nodes.size());
+        for(size_t i = p.lo, j = p.lo; i < p.hi; i = j) {
+            const char letter = table->get_str(words[i])[p.depth];
+            while(j < p.hi && table->get_str(words[j])[p.depth] == letter) ++j;
+
+            const uint32_t bit = 1u << static_cast<uint>(letter - 'a');
+            nodes.child_mask[p.node] |= bit;
+            nodes.live_mask[p.node] |= bit;
+
+            const uint32_t child = nodes.push_back(p.node, letter);
+            letters_table_entry& entry = letters_at_indices[p.depth][static_cast<size_t>(letter - 'a')];
+            entry.nodes.push_back(child);
+            entry.num_nodes++;
 
-                // create child node if it doesn't exist yet
-                if(!nodes[node_idx]->children.count(word.at(pos))) {
-                    // create and add node to children of current node, entry in letters_at_indices, and nodes
-                    nodes[node_idx]->children.insert({word.at(pos), nodes.size()});
-                    (*letters_at_indices)[pos][static_cast<size_t>(word.at(pos) - 'a')].nodes.insert(nodes.size());
-                    nodes.push_back(make_unique<trie_node>(
-                        nodes.size(), false, word.at(pos), node_idx
-                    ));
-                } 
-
-                // recurse to next letter
-                add_word_to_trie(nodes[node_idx]->children.at(word.at(pos)), word, pos + 1);
-            };
-
-            add_word_to_trie(TRIE_ROOT_NODE_IDX, w.word, 0);
+            pending.push({child, i, j, p.depth + 1});
         }
     }
+
+    // leaves of trie, in increasing rank of their words
+    leaves_by_rank.clear();
+    leaves_by_rank.reserve(words.size());
+    for(uint32_t node = 0; node < static_cast<uint32_t>(nodes.size()); ++node) {
+        if(nodes.word[node] != TRIE_NO_ID) leaves_by_rank.push_back(node);
+    }
+    std::sort(leaves_by_rank.begin(), leaves_by_rank.end(), [this](uint32_t lhs, uint32_t rhs) {
+        return table->get_rank(words[nodes.word[lhs]]) < table->get_rank(words[nodes.word[rhs]]);
+    });
+}
+
+/**
+ * @brief helper for build_domain() to rebuild bitmaps from words, with all words remaining
+*/
+void word_domain::build_bitmaps() {
+    const size_t word_len = words.empty() ? 0ul : table->get_str(words.front()).size();
+    bitmaps = make_shared<const letter_bitmaps>(*table, words, word_len);
+
+    // every word remains, bits past the last word stay clear
+    live_words.assign(bitmaps->num_blocks, ~0ul);
+    if(words.size() % WORD_BLOCK_BITS != 0) {
+        live_words.back() = (1ul << (words.size() % WORD_BLOCK_BITS)) - 1ul;
+    }
+
+    // every word counted in letter_counts and letters_present
+    letter_counts.assign(word_len * NUM_ENGLISH_LETTERS, 0u);
+    letters_present.assign(word_len, letter_bitset_t());
+    for(size_t bit = 0; bit < words.size(); ++bit) {
+        update_letter_counts<true>(bit);
+    }
 }
 
 /**
@@ -259,8 +357,9 @@ void word_domain::add_word(word_t w) {
  * @return true iff word is a valid word
  * @note behavior undefined if domain assigned, only intended to be called in cw_variable initialization
 */
-bool word_domain::is_word(string& word) const {
-    return word_map.count(word) > 0;
+bool word_domain::is_word(const string& word) const {
+    const optional<word_id_t> id = table->find_id(word);
+    return id.has_value() && std::binary_search(words.begin(), words.end(), id.value());
 }
 
 /**
@@ -270,50 +369,58 @@ bool word_domain::is_word(string& word) const {
  * @note behavior undefined if domain assigned, only intended to be called in cw_variable initialization
 */
 unordered_set<word_t> word_domain::find_matches(const string& pattern) const {
-    /**
-     * @brief private helper to find_matches() to recursively traverse tree to find matches
-     * 
-     * @param matches ptr to set to add matches to
-     * @param pattern the pattern to compare against
-     * @param pos index of next char in pattern to check
-     * @param node_idx idx in id_obj_manager of current node traversing in word_tree
-     * @param fragment part of word matched already
-    */
-    std::function<void(unordered_set<word_t>&, const string&, uint pos, const size_t, string)> traverse_to_find_matches;
-    traverse_to_find_matches = [this, &traverse_to_find_matches](unordered_set<word_t>& matches, const string& pattern, uint pos, const size_t node_idx, string fragment) {
-        utils.log(DEBUG, "entering traverse_to_find_matches() w/ pattern ", pattern, " at pos ", pos, " @ node ", nodes[node_idx]->letter);
+    unordered_set<word_t> matches;
 
-        // pattern fully matched
-        if(pos >= pattern.size()) {
-            // AND this is a valid word
-            utils.log(DEBUG, "pattern fully matched, valid check: ", nodes[node_idx]->valid);
+    if(backend == word_domain_backend::BITSET) {
+        if(pattern.size() != bitmaps->word_len) return matches;
+
+        // intersect remaining words with words having each letter of pattern
+        vector<word_block_t> candidates = live_words;
+        for(size_t i = 0; i < pattern.size(); ++i) {
+            if(pattern[i] == WILDCARD) continue;
+            if(pattern[i] < 'a' || pattern[i] > 'z') return matches;
 
-            if(nodes[node_idx]->valid) { 
-                matches.insert(word_map.at(fragment));
+            const word_block_t* mask = bitmaps->at(i, static_cast<size_t>(pattern[i] - 'a'));
+            for(size_t b = 0; b < candidates.size(); ++b) {
+                candidates[b] &= mask[b];
             }
-            return;
         }
 
-        if(pattern.at(pos) == WILDCARD) {
-            // wildcard at this index, add all possible matches
-            utils.log(DEBUG, "traversing for wild card");
+        for(size_t b = 0; b < candidates.size(); ++b) {
+            for(word_block_t bits = candidates[b]; bits; bits &= bits - 1ul) {
+                matches.insert(table->get_word(words[bitmaps->order[b * WORD_BLOCK_BITS + static_cast<size_t>(std::countr_zero(bits))]]));
+            }
+        }
+        return matches;
+    }
+
+    // nodes still to visit, as pairs of {node id, index of next char in pattern}
+    vector<pair<uint32_t, size_t> > to_visit = {{TRIE_ROOT_NODE_IDX, 0ul}};
+    while(!to_visit.empty()) {
+        const auto [node, pos] = to_visit.back();
+        to_visit.pop_back();
 
-            for(auto& pair : nodes[node_idx]->children) {
-                traverse_to_find_matches(matches, pattern, pos + 1, pair.second, fragment + pair.first);
+        // pattern fully matched, AND this is a valid word
+        if(pos >= pattern.size()) {
+            if(nodes.word[node] != TRIE_NO_ID) {
+                matches.insert(table->get_word(words[nodes.word[node]]));
             }
+            continue;
+        }
 
-        } else if(nodes[node_idx]->children.count(pattern.at(pos)) > 0) {
+        if(pattern[pos] == WILDCARD) {
+            // wildcard at this index, visit all children
+            for(uint32_t live = nodes.live_mask[node]; live; live &= live - 1u) {
+                to_visit.push_back({nodes.child(node, static_cast<char>('a' + std::countr_zero(live))), pos + 1});
+            }
+        } else if('a' <= pattern[pos] && pattern[pos] <= 'z' && (nodes.live_mask[node] & (1u << static_cast<uint>(pattern[pos] - 'a')))) {
             // next letter progresses towards a valid word, continue
-            utils.log(DEBUG, "traversing for letter ", pattern.at(pos));
-            traverse_to_find_matches(matches, pattern, pos + 1, nodes[node_idx]->children[pattern.at(pos)], fragment + pattern.at(pos));
-
+            to_visit.push_back({nodes.child(node, pattern[pos]), pos + 1});
         } else {
             // this is a dead end, do nothing
         }
-    };
+    }
 
-    unordered_set<word_t> matches;
-    traverse_to_find_matches(matches, pattern, 0, TRIE_ROOT_NODE_IDX, "");
     return matches;
 }
 
@@ -328,9 +435,16 @@ uint word_domain::num_letters_at_index(uint index, char letter) const {
     cw_assert(index < MAX_WORD_LEN);
     cw_assert('a' <= letter && letter <= 'z');
     if(assigned) {
-        return (assigned_value.has_value() && index < assigned_value.value().word.size() && assigned_value.value().word.at(index) == letter) ? 1u : 0u;
+        if(!assigned_value.has_value()) return 0u;
+        const string_view value = table->get_str(assigned_value.value());
+        return (index < value.size() && value[index] == letter) ? 1u : 0u;
+    }
+    if(backend == word_domain_backend::BITSET) {
+        if(index >= bitmaps->word_len) return 0u;
+        return letter_counts[letters_table_entry::lai_index(index, static_cast<size_t>(letter - 'a'))];
     }
-    return (*letters_at_indices)[index][static_cast<size_t>(letter - 'a')].num_words;
+    if(index >= letters_at_indices.size()) return 0u;
+    return letters_at_indices[index][static_cast<size_t>(letter - 'a')].num_words;
 }
 
 /**
@@ -350,19 +464,32 @@ letter_bitset_t word_domain::has_letters_at_index_with_letter_assigned(uint inde
 
     if(assigned) {
         if(assigned_value.has_value()) {
-            cw_assert(required_index < assigned_value.value().word.size());
-            cw_assert(index < assigned_value.value().word.size());
+            const string_view value = table->get_str(assigned_value.value());
+            cw_assert(required_index < value.size());
+            cw_assert(index < value.size());
 
-            if(assigned_value.value().word.at(required_index) == required_letter) {
-                res |= 1 << static_cast<uint>(assigned_value.value().word.at(index) - 'a');
+            if(value[required_index] == required_letter) {
+                res |= 1 << static_cast<uint>(value[index] - 'a');
             }
         }
     } else {
         cw_assert(index != required_index);
 
-        auto& target = (*letters_at_indices)[required_index][static_cast<size_t>(required_letter - 'a')].lai_subset;
+        if(backend == word_domain_backend::BITSET) {
+            const word_block_t* target = bitmaps->at(required_index, static_cast<size_t>(required_letter - 'a'));
+            for(size_t i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
+                if(letters[i] && blocks_intersect(live_words.data(), target, bitmaps->at(index, i), live_words.size())) {
+                    res |= 1 << i;
+                }
+            }
+            return res;
+        }
+
+        if(index >= letters_at_indices.size() || required_index >= letters_at_indices.size()) return res;
+
+        const vector<uint>& target = letters_at_indices[required_index][static_cast<size_t>(required_letter - 'a')].lai_subset;
         for(size_t i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
-            if(letters[i] && (*target)[index][i] > 0) {
+            if(letters[i] && target[letters_table_entry::lai_index(index, i)] > 0) {
                 res |= 1 << i;
             }
         }
@@ -375,26 +502,35 @@ letter_bitset_t word_domain::has_letters_at_index_with_letter_assigned(uint inde
  * @brief removes words with a specific letter at a specific index from trie
  * @warning behavior undefined if called in cw_variable initialization
  * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
- * @invariant # of layers in ac3_pruned_assigned_val and ac3_pruned_nodes/ac3_pruned_words in each element of letters_at_indices must all be equal
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
  * 
  * @param index the index to remove in the word(s)
  * @param letter the letter to remove, 'a' <= letter <= 'z'
  * @returns total # number of words/leaf nodes removed
 */
 size_t word_domain::remove_matching_words(uint index, char letter) {
+    cw_assert('a' <= letter && letter <= 'z');
+    return remove_matching_words(index, letter_bitset_t(1ul << static_cast<uint>(letter - 'a')));
+}
+
+/**
+ * @brief removes words with any of a set of letters at a specific index from trie, in one pass over the domain
+ * @warning behavior undefined if called in cw_variable initialization
+ * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+ * 
+ * @param index the index to remove in the word(s)
+ * @param letters 0-indexed bitset of letters to remove, i.e. index 0 == 'a'
+ * @returns total # number of words/leaf nodes removed
+*/
+size_t word_domain::remove_matching_words(uint index, const letter_bitset_t& letters) {
     // check precondition and invariant
-    size_t stack_depth = ac3_pruned_assigned_val.size();
-    cw_assert_m(stack_depth > 0, "ac3_pruned_assigned_val depth is 0 upon call to remove_matching_words()");
-    for(uint i = 0; i < MAX_WORD_LEN; i++) {
-        for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_nodes.size() == stack_depth, "stack depth invariant violated for ac3_pruned_nodes");
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_words.size() == stack_depth, "stack depth invariant violated for ac3_pruned_words");
-        }
-    }
+    cw_assert_m(ac3_pruned_assigned_val.size() > 0, "ac3_pruned_assigned_val depth is 0 upon call to remove_matching_words()");
+    cw_assert_m(ac3_trail_marks.size() == ac3_pruned_assigned_val.size(), "stack depth invariant violated for ac3_trail_marks");
 
     if(assigned) { // assigned value
-        if(assigned_value.has_value() && assigned_value.value().word.at(index) == letter) {
-            ac3_pruned_assigned_val.top() = optional<word_t>(assigned_value.value()); // prune, add to ac3 layer
+        if(assigned_value.has_value() && letters[static_cast<size_t>(table->get_str(assigned_value.value()).at(index) - 'a')]) {
+            ac3_pruned_assigned_val.top() = assigned_value; // prune, add to ac3 layer
             assigned_value.reset();
 
             // letters_at_indices not updated since it's contents are undefined if assigned
@@ -403,114 +539,58 @@ size_t word_domain::remove_matching_words(uint index, char letter) {
         } else {
             return 0;
         }
-    } else { // regular case
-
-        /**
-         * @brief downwards private helper for remove_matching_words(), records and removes all children of this node recursively and updates letters_at_indices
-         * @warning behavior undefined if called in cw_variable initialization
-         * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
-         * @invariant # of layers in ac3_pruned_assigned_val and ac3_pruned_nodes/ac3_pruned_words in each element of letters_at_indices must all be equal
-         * 
-         * @param node_idx idx of current node whose children (not itself) will be removed
-         * @param index depth of this parent node in trie or letter index in the word, root trie node defined as index/depth -1
-         * @returns number of words/leaf nodes removed
-        */
-       std::function<uint(const size_t, uint)> remove_children;
-       remove_children = [this, &remove_children](const size_t node_idx, uint index) -> uint {
-            cw_assert((*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].nodes.count(node_idx) > 0);
-            (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].ac3_pruned_nodes.top().insert(node_idx); // prune, add to ac3 layer
-            (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].nodes.erase(node_idx); 
-
-            // base case for leaf nodes
-            if(nodes[node_idx]->valid) {
-                // terminates valid word, assumed to be a leaf node since all domain values in cw_variable are equal length
-                cw_assert(nodes[node_idx]->children.size() == 0);
-
-                // update letters_at_indices word count values
-                (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].num_words--;
-                (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].ac3_pruned_words.top() += 1; // prune, add to ac3 layer
-
-                // update lai_subset word count values
-                cw_assert(update_lai_subsets<false, true>(node_idx) == index + 1);
-
-                // leaf node represents 1 word
-                return 1u;
-            }
+    } else if(backend == word_domain_backend::BITSET) { // bitmap case
+        cw_assert(index < bitmaps->word_len);
+
+        // bitmaps of words with each letter to remove at index
+        array<const word_block_t*, NUM_ENGLISH_LETTERS> masks;
+        size_t num_masks = 0;
+        for(size_t i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
+            if(letters[i]) masks[num_masks++] = bitmaps->at(index, i);
+        }
+
+        // clear remaining words with any letter at index, recording which were cleared
+        size_t total_removed = 0;
+        for(size_t b = 0; b < live_words.size(); ++b) {
+            if(!live_words[b]) continue;
 
-            // recursive calls to children
-            uint num_leafs = 0;
-            for(const auto& pair : nodes[node_idx]->children) {
-                num_leafs += remove_children(pair.second, index + 1);
+            word_block_t removed = 0ul;
+            for(size_t i = 0; i < num_masks; ++i) {
+                removed |= masks[i][b];
             }
+            removed &= live_words[b];
 
-            // update num_words
-            (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].num_words -= num_leafs;
-            (*letters_at_indices)[index][static_cast<size_t>(nodes[node_idx]->letter - 'a')].ac3_pruned_words.top() += num_leafs; // prune, add to ac3 layer
-
-            // for details on why these links aren't saved, see the proof in word_domain_data_types.h
-            nodes[node_idx]->children.clear();
-
-            return num_leafs;
-       };
-
-        /**
-         * @brief upwards private helper for remove_matching_words(), updates letters_at_indices and removes nodes without remaining valid leafs
-         * @warning behavior undefined if called in cw_variable initialization
-         * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
-         * @invariant # of layers in ac3_pruned_assigned_val and ac3_pruned_nodes/ac3_pruned_words in each element of letters_at_indices must all be equal
-         * 
-         * @param node_idx idx of this node which may be removed from its parent 
-         * @param num_leafs number of valid words/leafs removed from the original call to remove_matching_words()
-         * @param index depth of this node in trie or letter index in the word, root trie node defined as index/depth -1
-         * @param letters_at_indices_updated true iff node is a node remove_children() was already called on, to avoid double updating
-         * @note letters_at_indices_updated should only be true on the first recursive call for each node iterated on in remove_matching_words()
-        */
-        std::function<void(const size_t, uint&, int, bool)> remove_from_parents;
-        remove_from_parents = [this, &remove_from_parents](const size_t node_idx, uint& num_leafs, int index, bool letters_at_indices_updated) {
-            // check for base case of reached root node of trie
-            const size_t parent = nodes[node_idx]->parent;
-            if(parent != id_obj_manager<trie_node>::INVALID_ID) {
-
-                // check if node has no valid leafs of its own and thus should be removed from parent
-                if(nodes[node_idx]->children.size() == 0) {
-                    // if this is the first recursive call, remove_children() already updated letters_at_indices for this node
-                    if(!letters_at_indices_updated) {
-                        (*letters_at_indices)[static_cast<size_t>(index)][static_cast<size_t>(nodes[node_idx]->letter - 'a')].ac3_pruned_nodes.top().insert(node_idx); // prune, add to ac3 layer
-                        (*letters_at_indices)[static_cast<size_t>(index)][static_cast<size_t>(nodes[node_idx]->letter - 'a')].nodes.erase(node_idx);
-                    }
-
-                    // remove node as child from parent
-                    // for details on why this link isn't saved, see the proof in word_domain_data_types.h
-                    nodes[parent]->children.erase(nodes[node_idx]->letter);
-                }
+            if(removed) {
+                live_words[b] &= ~removed;
+                ac3_block_trail.push_back({b, removed}); // prune, add to trail
+                total_removed += static_cast<size_t>(std::popcount(removed));
 
-                // if this is the first recursive call, remove_children() already updated letters_at_indices for this node
-                if(!letters_at_indices_updated) { 
-                    (*letters_at_indices)[static_cast<size_t>(index)][static_cast<size_t>(nodes[node_idx]->letter - 'a')].num_words -= num_leafs;
-                    (*letters_at_indices)[static_cast<size_t>(index)][static_cast<size_t>(nodes[node_idx]->letter - 'a')].ac3_pruned_words.top() += num_leafs; // prune, add to ac3 layer
+                // update letter_counts word count values
+                for(word_block_t bits = removed; bits; bits &= bits - 1ul) {
+                    update_letter_counts<false>(b * WORD_BLOCK_BITS + static_cast<size_t>(std::countr_zero(bits)));
                 }
-
-                // recurse upwards
-                remove_from_parents(parent, num_leafs, index - 1, false);
             }
-        };
+        }
 
-        uint num_leafs;
+        unassigned_domain_size -= total_removed;
+        return total_removed;
+    } else { // trie case
         size_t total_leafs = 0;
+        if(index >= letters_at_indices.size() || letters.none()) return total_leafs;
 
-        // need to make copy since removing from set being iterated on, should deallocate when out of scope
-        unordered_set<size_t> nodes_copy = (*letters_at_indices)[index][static_cast<size_t>(letter - 'a')].nodes;
-        for(size_t node_idx : nodes_copy) {
-            if(nodes[node_idx]->parent != id_obj_manager<trie_node>::INVALID_ID) {
-                // downwards removal in trie
-                num_leafs = remove_children(node_idx, index);
-                cw_assert(num_leafs > 0);
-                total_leafs += num_leafs;
-
-                // upwards removal in trie
-                remove_from_parents(node_idx, num_leafs, static_cast<int>(index), true);
-            } else {
-                utils.log(ERROR, "parent of node index ", index, ", letter ", letter, " deleted early");
+        if(letters.count() == 1) {
+            // node list is fixed once trie is built, so no copy needed even though nodes are removed while iterating
+            const size_t letter = static_cast<size_t>(std::countr_zero(letters.to_ulong()));
+            for(const uint32_t node : letters_at_indices[index][letter].nodes) {
+                if(nodes.is_live(node)) total_leafs += remove_trie_children(nodes.parent[node], 1u << letter, index);
+            }
+        } else {
+            // visit every live node at depth index once, removing all its children with letters to remove together
+            const uint32_t letter_bits = static_cast<uint32_t>(letters.to_ulong());
+            const auto [first, last] = nodes.depth_range(index);
+            for(uint32_t parent = first; parent < last; ++parent) {
+                const uint32_t doomed = nodes.live_mask[parent] & letter_bits;
+                if(doomed && nodes.is_live(parent)) total_leafs += remove_trie_children(parent, doomed, index);
             }
         }
 
@@ -520,89 +600,240 @@ size_t word_domain::remove_matching_words(uint index, char letter) {
 }
 
 /**
- * @brief start new AC-3 call, during which remove_matching_words() may be called 0 or more times
- * @note causes new layer to be added to ac3_pruned_assigned_val, and ac3_pruned_nodes in each element of letters_at_indices
- * @invariant # of layers in ac3_pruned_assigned_val and ac3_pruned_nodes/ac3_pruned_words in each element of letters_at_indices must all be equal
+ * @brief removes a single word from domain, e.g. one assigned to another variable, recording it to be restored like remove_matching_words()
+ * @warning behavior undefined if called in cw_variable initialization
+ * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+ * 
+ * @param id id of word in get_table() to remove
+ * @returns 1 if word was in domain and is removed, 0 otherwise
 */
-void word_domain::start_new_ac3_call() {
-    // check invariant
-    size_t stack_depth = ac3_pruned_assigned_val.size();
-    for(uint i = 0; i < MAX_WORD_LEN; i++) {
-        for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_nodes.size() == stack_depth, "stack depth invariant violated for ac3_pruned_nodes");
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_words.size() == stack_depth, "stack depth invariant violated for ac3_pruned_words");
+size_t word_domain::remove_word(word_id_t id) {
+    // check precondition and invariant
+    cw_assert_m(ac3_pruned_assigned_val.size() > 0, "ac3_pruned_assigned_val depth is 0 upon call to remove_word()");
+    cw_assert_m(ac3_trail_marks.size() == ac3_pruned_assigned_val.size(), "stack depth invariant violated for ac3_trail_marks");
+
+    if(assigned) { // assigned value
+        if(assigned_value == id) {
+            ac3_pruned_assigned_val.top() = assigned_value; // prune, add to ac3 layer
+            assigned_value.reset();
+            return 1;
         }
+        return 0;
+    } else if(backend == word_domain_backend::BITSET) { // bitmap case
+        // words are numbered by rank, so its bit is found by binary search
+        const uint32_t rank = table->get_rank(id);
+        const auto it = std::lower_bound(bitmaps->order.begin(), bitmaps->order.end(), rank, [this](uint32_t pos, uint32_t rhs) {
+            return table->get_rank(words[pos]) < rhs;
+        });
+        if(it == bitmaps->order.end() || words[*it] != id) return 0;
+        const size_t bit = static_cast<size_t>(it - bitmaps->order.begin());
+        const size_t b = bit / WORD_BLOCK_BITS;
+        const word_block_t removed = live_words[b] & (word_block_t(1) << (bit % WORD_BLOCK_BITS));
+        if(!removed) return 0;
+
+        live_words[b] &= ~removed;
+        ac3_block_trail.push_back({b, removed}); // prune, add to trail
+        update_letter_counts<false>(bit);
+        unassigned_domain_size--;
+        return 1;
+    } else { // trie case
+        // follow live edges along letters of word, which is absent if any is missing
+        // all words in domain are as long as letters_at_indices, so only words of that length can be in it
+        const string_view word = table->get_str(id);
+        if(word.empty() || word.size() != letters_at_indices.size()) return 0;
+        uint32_t node = TRIE_ROOT_NODE_IDX;
+        for(size_t i = 0; i + 1 < word.size(); ++i) {
+            if(!(nodes.live_mask[node] & (1u << static_cast<uint>(word[i] - 'a')))) return 0;
+            node = nodes.child(node, word[i]);
+        }
+        const uint32_t leaf_bit = 1u << static_cast<uint>(word.back() - 'a');
+        if(!(nodes.live_mask[node] & leaf_bit)) return 0;
+        cw_assert(nodes.word[nodes.child(node, word.back())] != TRIE_NO_ID);
+
+        const size_t num_leafs = remove_trie_children(node, leaf_bit, static_cast<uint>(word.size() - 1));
+        unassigned_domain_size -= num_leafs;
+        return num_leafs;
     }
+}
 
-    ac3_pruned_assigned_val.push(std::nullopt);
-    for(uint i = 0; i < MAX_WORD_LEN; i++) {
-        for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
-            (*letters_at_indices)[i][j].ac3_pruned_nodes.push(unordered_set<size_t>());
-            (*letters_at_indices)[i][j].ac3_pruned_words.push(0);
+/**
+ * @brief for TRIE backend, removes children of a node with some letters and their subtrees, updating letters_at_indices
+ * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+ * 
+ * @param parent id of live node at depth index, i.e. whose children have letters at index
+ * @param doomed bitmask of letters of children of parent to remove, all live
+ * @param index letter index in the word of children to remove
+ * @returns number of words/leaf nodes removed
+*/
+uint word_domain::remove_trie_children(const uint32_t parent, const uint32_t doomed, uint index) {
+    /**
+     * @brief downwards private helper for remove_trie_children(), records and removes all children of this node recursively and updates letters_at_indices
+     * @warning behavior undefined if called in cw_variable initialization
+     * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
+     * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+     * 
+     * @param self this lambda, for recursion
+     * @param node id of current node whose children (not itself) will be removed
+     * @param index depth of this parent node in trie or letter index in the word, root trie node defined as index/depth -1
+     * @returns number of words/leaf nodes removed
+    */
+    auto remove_children = [this](auto& self, const uint32_t node, uint index) -> uint {
+        letters_table_entry& entry = letters_at_indices[index][static_cast<size_t>(nodes.letter[node] - 'a')];
+        cw_assert(entry.num_nodes > 0);
+        entry.num_nodes--;
+
+        // base case for leaf nodes
+        if(nodes.word[node] != TRIE_NO_ID) {
+            // terminates valid word, assumed to be a leaf node since all domain values in cw_variable are equal length
+            cw_assert(nodes.live_mask[node] == 0u);
+
+            // update letters_at_indices word count values
+            update_letter_count<false>(entry.num_words, index, static_cast<size_t>(nodes.letter[node] - 'a'), 1u);
+            ac3_trie_trail.push_back({node, 1u, static_cast<uint8_t>(index), true}); // prune, add to trail
+
+            // update lai_subset word count values
+            cw_assert(update_lai_subsets<false, true>(node) == index + 1);
+
+            // leaf node represents 1 word
+            return 1u;
         }
+
+        // recursive calls to children
+        uint num_leafs = 0;
+        for(uint32_t live = nodes.live_mask[node]; live; live &= live - 1u) {
+            num_leafs += self(self, nodes.child(node, static_cast<char>('a' + std::countr_zero(live))), index + 1);
+        }
+
+        // update num_words
+        update_letter_count<false>(entry.num_words, index, static_cast<size_t>(nodes.letter[node] - 'a'), num_leafs);
+        ac3_trie_trail.push_back({node, num_leafs, static_cast<uint8_t>(index), true}); // prune, add to trail
+
+        // for details on why these links aren't saved, see the proof in word_domain_data_types.h
+        nodes.live_mask[node] = 0u;
+
+        return num_leafs;
+    };
+
+    /**
+     * @brief upwards private helper for remove_trie_children(), updates letters_at_indices and removes nodes without remaining valid leafs
+     * @warning behavior undefined if called in cw_variable initialization
+     * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
+     * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+     * 
+     * @param node id of first node which may be removed from its parent, whose children were removed
+     * @param num_leafs number of valid words/leafs removed from children of node
+     * @param index depth of node in trie or letter index in the word, root trie node defined as index/depth -1
+    */
+    auto remove_from_parents = [this](uint32_t node, uint num_leafs, int index) {
+        // iterate until reached root node of trie
+        for(uint32_t parent = nodes.parent[node]; parent != TRIE_NO_ID; node = parent, parent = nodes.parent[node], --index) {
+            letters_table_entry& entry = letters_at_indices[static_cast<size_t>(index)][static_cast<size_t>(nodes.letter[node] - 'a')];
+
+            // check if node has no valid leafs of its own and thus should be removed from parent
+            const bool pruned = nodes.live_mask[node] == 0u;
+            if(pruned) {
+                entry.num_nodes--;
+
+                // remove node as child from parent
+                // for details on why this link isn't saved, see the proof in word_domain_data_types.h
+                nodes.live_mask[parent] &= ~(1u << static_cast<uint>(nodes.letter[node] - 'a'));
+            }
+
+            update_letter_count<false>(entry.num_words, static_cast<size_t>(index), static_cast<size_t>(nodes.letter[node] - 'a'), num_leafs);
+            ac3_trie_trail.push_back({node, num_leafs, static_cast<uint8_t>(index), pruned}); // prune, add to trail
+        }
+    };
+
+    cw_assert((nodes.live_mask[parent] & doomed) == doomed);
+
+    // downwards removal in trie
+    uint num_leafs = 0;
+    for(uint32_t bits = doomed; bits; bits &= bits - 1u) {
+        num_leafs += remove_children(remove_children, nodes.child(parent, static_cast<char>('a' + std::countr_zero(bits))), index);
     }
+    cw_assert(num_leafs > 0);
+    nodes.live_mask[parent] &= ~doomed;
+
+    // upwards removal in trie, once for all children removed
+    remove_from_parents(parent, num_leafs, static_cast<int>(index) - 1);
+    return num_leafs;
+}
+
+/**
+ * @brief start new AC-3 call, during which remove_matching_words() may be called 0 or more times
+ * @note causes new layer to be added to ac3_pruned_assigned_val, and current end of trail to be marked in ac3_trail_marks
+ * @note O(1), layers only cost memory for the words they prune
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
+*/
+void word_domain::start_new_ac3_call() {
+    // check invariant
+    cw_assert_m(ac3_trail_marks.size() == ac3_pruned_assigned_val.size(), "stack depth invariant violated for ac3_trail_marks");
+
+    ac3_pruned_assigned_val.push(std::nullopt);
+    ac3_trail_marks.push_back(backend == word_domain_backend::TRIE ? ac3_trie_trail.size() : ac3_block_trail.size());
 }
 
 /**
  * @brief undo previous AC-3 call, restoring the nodes to letters_at_indices and assigned_value
  * @pre prior to this, start_new_ac3_call() must have been called more times than the # of prior calls to undo_prev_ac3_call()
- * @invariant # of layers in ac3_pruned_assigned_val and ac3_pruned_nodes in each element of letters_at_indices must all be equal
+ * @invariant # of layers in ac3_pruned_assigned_val and ac3_trail_marks must be equal
  * @returns number of words/leaf nodes and assigned values restored
 */
 size_t word_domain::undo_prev_ac3_call() {
     // check precondition and invariant
-    size_t stack_depth = ac3_pruned_assigned_val.size();
-    cw_assert_m(stack_depth > 0, "ac3_pruned_assigned_val depth is 0 upon call to undo_prev_ac3_call()");
-    for(uint i = 0; i < MAX_WORD_LEN; i++) {
-        for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_nodes.size() == stack_depth, "stack depth invariant violated for ac3_pruned_nodes");
-            cw_assert_m((*letters_at_indices)[i][j].ac3_pruned_words.size() == stack_depth, "stack depth invariant violated for ac3_pruned_words");
-        }
-    }
+    cw_assert_m(ac3_pruned_assigned_val.size() > 0, "ac3_pruned_assigned_val depth is 0 upon call to undo_prev_ac3_call()");
+    cw_assert_m(ac3_trail_marks.size() == ac3_pruned_assigned_val.size(), "stack depth invariant violated for ac3_trail_marks");
+    const size_t mark = ac3_trail_marks.back();
+    ac3_trail_marks.pop_back();
     
-    // restore regular letters_at_indices entries
+    // undo trail records since start of this AC-3 call, restoring letters_at_indices entries or remaining words bitmap
     size_t num_restored = 0;
-    size_t num_restored_per_index = 0;
-    for(uint i = 0; i < MAX_WORD_LEN; i++) {
-        num_restored_per_index = 0;
-        for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
-            // restore nodes
-            (*letters_at_indices)[i][j].nodes.insert(
-                (*letters_at_indices)[i][j].ac3_pruned_nodes.top().begin(), (*letters_at_indices)[i][j].ac3_pruned_nodes.top().end()
-            );
-            // don't pop ac3_pruned_nodes yet, need it to restore links from parents
-
-            // restore edges from parent nodes
-            for(const size_t node_idx : (*letters_at_indices)[i][j].ac3_pruned_nodes.top()) {
-                const size_t parent = nodes[node_idx]->parent;
-                if(parent != id_obj_manager<trie_node>::INVALID_ID) {
-                    cw_assert_m(i == 0 || (*letters_at_indices)[i-1][static_cast<size_t>(nodes[parent]->letter - 'a')].nodes.count(parent) > 0, "parent node not yet restored in undo_prev_ac3_call() call");
-                    cw_assert_m(nodes[parent]->children.count(nodes[node_idx]->letter) == 0, "parent node still contains edge to child in undo_prev_ac3_call() call");
-                    nodes[parent]->children.insert({nodes[node_idx]->letter, node_idx});
-                } else {
-                    utils.log(ERROR, "parent of node index ", i, ", letter ", j, " deleted early during restoration");
-                }
+    if(backend == word_domain_backend::BITSET) {
+        for(size_t t = mark; t < ac3_block_trail.size(); ++t) {
+            const auto& [b, removed] = ac3_block_trail[t];
+            cw_assert_m(!(live_words[b] & removed), "restoring word still in domain in undo_prev_ac3_call() call");
+            live_words[b] |= removed;
+            num_restored += static_cast<size_t>(std::popcount(removed));
+
+            // restore letter_counts word count values
+            for(word_block_t bits = removed; bits; bits &= bits - 1ul) {
+                update_letter_counts<true>(b * WORD_BLOCK_BITS + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+        ac3_block_trail.resize(mark);
+    } else {
+        for(size_t t = mark; t < ac3_trie_trail.size(); ++t) {
+            const trie_trail_entry& record = ac3_trie_trail[t];
+            letters_table_entry& entry = letters_at_indices[record.index][static_cast<size_t>(nodes.letter[record.node] - 'a')];
+
+            // restore num_words to update letters_at_indices word counts
+            update_letter_count<true>(entry.num_words, record.index, static_cast<size_t>(nodes.letter[record.node] - 'a'), record.num_words);
+
+            // restore node and edge from parent node
+            if(record.pruned) {
+                const uint32_t parent = nodes.parent[record.node];
+                const uint32_t bit = 1u << static_cast<uint>(nodes.letter[record.node] - 'a');
+                cw_assert_m(parent != TRIE_NO_ID, "restoring root node in undo_prev_ac3_call() call");
+                cw_assert_m(!(nodes.live_mask[parent] & bit), "parent node still contains edge to child in undo_prev_ac3_call() call");
+                nodes.live_mask[parent] |= bit;
+                entry.num_nodes++;
 
                 // update lai_subsets word counts
-                if(nodes[node_idx]->valid) {
-                    cw_assert(nodes[node_idx]->children.size() == 0);
-                    cw_assert(update_lai_subsets<true, true>(node_idx) == i + 1);
+                if(nodes.word[record.node] != TRIE_NO_ID) {
+                    cw_assert(nodes.live_mask[record.node] == 0u);
+                    cw_assert(update_lai_subsets<true, true>(record.node) == record.index + 1u);
+                    num_restored++;
                 }
             }
-            (*letters_at_indices)[i][j].ac3_pruned_nodes.pop();
-
-            // restore num_words to update letters_at_indices word counts
-            (*letters_at_indices)[i][j].num_words += (*letters_at_indices)[i][j].ac3_pruned_words.top();
-            num_restored_per_index += (*letters_at_indices)[i][j].ac3_pruned_words.top();
-            (*letters_at_indices)[i][j].ac3_pruned_words.pop();
         }
-        cw_assert_m(i == 0 || num_restored_per_index == 0 || num_restored == num_restored_per_index, "restoring unequal # of words per index in undo_prev_ac3_call() call");
-        if(num_restored_per_index != 0) num_restored = num_restored_per_index;
+        ac3_trie_trail.resize(mark);
     }
     if(num_restored > 0) cw_assert_m(!assigned, "assigned upon restoring nonzero values in undo_prev_ac3_call() call");
     
     // restore assigned value
-    optional<word_t> popped_assignment = ac3_pruned_assigned_val.top();
+    optional<word_id_t> popped_assignment = ac3_pruned_assigned_val.top();
     ac3_pruned_assigned_val.pop();
     if(popped_assignment.has_value()) {
         cw_assert_m(num_restored == 0, "restoring to letters_at_indices and assigned_value in undo_prev_ac3_call() call");
@@ -627,6 +858,7 @@ size_t word_domain::size() const {
 
 /**
  * @brief get letters at an index in the current domain, for AC-3 constraint satisfaction checking
+ * @note O(1), letters_present is updated whenever a word count at index crosses zero
  * @param index the index to get letters for
  * @returns bitset where true --> corresponding letter appears  at specified index in current domain (taking into account assignment) 
 */
@@ -636,118 +868,251 @@ letter_bitset_t word_domain::get_all_letters_at_index(uint index) const {
     letter_bitset_t result;
     if(assigned) {
         if(assigned_value.has_value()) {
-            cw_assert_m(index < assigned_value.value().word.size(), "index out of bounds in letters_at_index() call");
+            const string_view value = table->get_str(assigned_value.value());
+            cw_assert_m(index < value.size(), "index out of bounds in letters_at_index() call");
             
-            result |= 1 << static_cast<uint>(assigned_value.value().word.at(index) - 'a');
-        }
-    } else {
-        for(uint i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
-            if(num_letters_at_index(index, static_cast<char>(i + 'a')) > 0) {
-                result |= 1 << i;
-            }
+            result |= 1 << static_cast<uint>(value[index] - 'a');
         }
+    } else if(index < letters_present.size()) {
+        result = letters_present[index];
     }
-    
+
     return result;
 }
 
 /**
- * @brief get vector containing all words in the current domain
- * @returns unsorted vector of all words in the current domain
+ * @brief get vector containing ids of all words in the current domain
+ * @returns unsorted vector of ids in get_table() of all words in the current domain
 */
-vector<word_t> word_domain::get_cur_domain() const {
+vector<word_id_t> word_domain::get_cur_domain_ids() const {
+    vector<word_id_t> acc;
+    acc.reserve(size());
+    append_cur_domain_ids(acc);
+    return acc;
+}
+
+/**
+ * @brief append ids of all words in the current domain to a buffer, without allocating beyond growing it
+ * @note visits only words remaining in the domain, unlike get_cur_domain_ranked(), which also steps over pruned ranks
+ *
+ * @param acc buffer to append unsorted ids in get_table() of all words in the current domain to
+*/
+void word_domain::append_cur_domain_ids(vector<word_id_t>& acc) const {
     if(assigned) {
-        if(assigned_value.has_value()) return { assigned_value.value() };
-        return {};
+        if(assigned_value.has_value()) acc.push_back(assigned_value.value());
+        return;
     }
 
-    /**
-     * @brief private helper for get_cur_domain(), traverses trie and adds words to accumulator
-     * 
-     * @param node_idx idx of current node in the traversal
-     * @param fragment letters from traversal so far up to and not including the current node
-     * @param acc accumulator vector to write back valid words to
-    */
-    std::function<void(const size_t, string, vector<word_t>&)> collect_cur_domain;
-    collect_cur_domain = [this, &collect_cur_domain](const size_t node_idx, string fragment, vector<word_t>& acc) {
-        string fragment_with_cur_node = (node_idx == TRIE_ROOT_NODE_IDX) ? fragment : fragment + nodes[node_idx]->letter;
+    if(backend == word_domain_backend::BITSET) {
+        for(size_t b = 0; b < live_words.size(); ++b) {
+            for(word_block_t bits = live_words[b]; bits; bits &= bits - 1ul) {
+                acc.push_back(words[bitmaps->order[b * WORD_BLOCK_BITS + static_cast<size_t>(std::countr_zero(bits))]]);
+            }
+        }
+        return;
+    }
+
+    // depth first traversal over live edges, each level leaves at most all but one of its children on the stack
+    array<uint32_t, NUM_ENGLISH_LETTERS * MAX_WORD_LEN + 1> to_visit;
+    size_t num_to_visit = 0;
+    to_visit[num_to_visit++] = TRIE_ROOT_NODE_IDX;
+    while(num_to_visit > 0) {
+        const uint32_t node = to_visit[--num_to_visit];
 
         // base case for leaf nodes
-        if(nodes[node_idx]->valid) {
+        if(nodes.word[node] != TRIE_NO_ID) {
             // terminates valid word, assumed to be a leaf node since all domain values in cw_variable are equal length
-            cw_assert(nodes[node_idx]->children.size() == 0);
+            cw_assert(nodes.live_mask[node] == 0u);
 
-            acc.push_back(word_map.at(fragment_with_cur_node));
-            return;
+            acc.push_back(words[nodes.word[node]]);
+            continue;
         }
 
-        // recursive calls to children
-        for(const auto& pair : nodes[node_idx]->children) {
-            collect_cur_domain(pair.second, fragment_with_cur_node, acc);
+        // visit children
+        for(uint32_t live = nodes.live_mask[node]; live; live &= live - 1u) {
+            cw_assert(num_to_visit < to_visit.size());
+            to_visit[num_to_visit++] = nodes.child(node, static_cast<char>('a' + std::countr_zero(live)));
         }
-    };
+    }
+}
+
+/**
+ * @brief helper for ranked_domain to get the first position in ranked order at or after pos with a word remaining in the current domain
+ * 
+ * @param pos position in ranked order to start searching from
+ * @param over_assigned true iff iterating over the assigned value rather than the unassigned domain
+ * @returns first position at or after pos of a remaining word, or ranked_end(over_assigned) if none
+*/
+size_t word_domain::next_ranked(size_t pos, bool over_assigned) const {
+    const size_t end = ranked_end(over_assigned);
+    if(over_assigned) {
+        return (pos == 0 && assigned_value.has_value()) ? 0ul : end;
+    }
+    if(pos >= end) return end;
+
+    if(backend == word_domain_backend::BITSET) {
+        // remaining words numbered by rank, so next set bit is next remaining word
+        size_t b = pos / WORD_BLOCK_BITS;
+        word_block_t bits = live_words[b] & (~0ul << (pos % WORD_BLOCK_BITS));
+        while(!bits) {
+            if(++b >= live_words.size()) return end;
+            bits = live_words[b];
+        }
+        return b * WORD_BLOCK_BITS + static_cast<size_t>(std::countr_zero(bits));
+    }
+
+    // a leaf remains iff the edge from its parent does, since pruning an ancestor also clears every live edge below it
+    while(pos < end && !nodes.is_live(leaves_by_rank[pos])) ++pos;
+    return pos;
+}
+
+/**
+ * @brief helper for ranked_domain to get the id of the word at a position in ranked order
+ * 
+ * @param pos position of a remaining word, as returned by next_ranked()
+ * @param over_assigned true iff iterating over the assigned value rather than the unassigned domain
+ * @returns id in get_table() of word at pos
+*/
+word_id_t word_domain::ranked_id(size_t pos, bool over_assigned) const {
+    cw_assert(pos < ranked_end(over_assigned));
+    if(over_assigned) return assigned_value.value();
+    if(backend == word_domain_backend::BITSET) return words[bitmaps->order[pos]];
+    return words[nodes.word[leaves_by_rank[pos]]];
+}
 
+/**
+ * @brief helper for ranked_domain to get the number of positions in ranked order, remaining or not
+ * 
+ * @param over_assigned true iff iterating over the assigned value rather than the unassigned domain
+*/
+size_t word_domain::ranked_end(bool over_assigned) const {
+    if(over_assigned) return 1ul;
+    return backend == word_domain_backend::BITSET ? words.size() : leaves_by_rank.size();
+}
+
+/**
+ * @brief get vector containing all words in the current domain, looking up each id in table
+ * @returns unsorted vector of all words in the current domain
+*/
+vector<word_t> word_domain::get_cur_domain() const {
     vector<word_t> acc;
-    collect_cur_domain(TRIE_ROOT_NODE_IDX, "", acc);
+    for(const word_id_t id : get_cur_domain_ids()) {
+        acc.push_back(table->get_word(id));
+    }
     return acc;
 }
 
+/**
+ * @brief get vector of all words ever added for testing
+ * @returns all words ever added in lexicographic order, including those pruned or not assigned
+*/
+vector<word_t> word_domain::get_all_words() const {
+    vector<word_t> acc;
+    acc.reserve(words.size());
+    for(const word_id_t id : words) {
+        acc.push_back(table->get_word(id));
+    }
+    return acc;
+}
+
+/**
+ * @brief get copy of letters_at_indices for testing, padded to MAX_WORD_LEN rows
+ * @returns letters_at_indices, or for BITSET backend a table where only num_words is filled in
+*/
+letter_idx_table<letters_table_entry> word_domain::get_letters_at_indices() const {
+    letter_idx_table<letters_table_entry> res;
+    if(backend == word_domain_backend::TRIE) {
+        std::copy(letters_at_indices.begin(), letters_at_indices.end(), res.begin());
+        return res;
+    }
+
+    for(uint i = 0; i < MAX_WORD_LEN; ++i) {
+        for(uint j = 0; j < NUM_ENGLISH_LETTERS; ++j) {
+            res[i][j].num_words = num_letters_at_index(i, static_cast<char>(j + 'a'));
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief update a count of remaining words with a letter at an index, keeping letters_present in sync with it
+ * 
+ * @param count letters_at_indices num_words entry or letter_counts entry to update
+ * @param index index of the count
+ * @param letter letter of the count, 0-indexed i.e. 0 == 'a'
+ * @param num_words number of words added/removed
+ * @param Add true --> words added, false --> words removed
+*/
+template <bool Add>
+void word_domain::update_letter_count(uint& count, size_t index, size_t letter, uint num_words) {
+    if constexpr(Add) {
+        if(count == 0u && num_words > 0u) letters_present[index].set(letter);
+        count += num_words;
+    } else {
+        cw_assert(count >= num_words);
+        count -= num_words;
+        if(count == 0u) letters_present[index].reset(letter);
+    }
+}
+
+/**
+ * @brief update values of letter_counts for BITSET backend given addition/removal of a word from active domain
+ * 
+ * @param bit number in bitmaps of word being added/removed
+ * @param Add true --> word added, false --> word removed
+*/
+template <bool Add>
+void word_domain::update_letter_counts(size_t bit) {
+    const string_view w = table->get_str(words[bitmaps->order[bit]]);
+    for(size_t i = 0; i < w.size(); ++i) {
+        const size_t letter = static_cast<size_t>(w[i] - 'a');
+        update_letter_count<Add>(letter_counts[letters_table_entry::lai_index(i, letter)], i, letter, 1u);
+    }
+}
+
 /**
  * @brief update values of lai_subset in letters_at_indices given addition/removal of a word from active domain
  * 
- * @param leaf idx of leaf node in id_obj_manager of word being added/removed
+ * @param leaf id of leaf node in trie of word being added/removed
  * @param Add true --> word added, false --> word removed
  * @param AssumeFixedSizeWords set true if all domain values expected to be the same length, enables an assert statement
  * @return inferred length of word based on trie, for defensive programming purposes
 */
 template <bool Add, bool AssumeFixedSizeWords>
-size_t word_domain::update_lai_subsets(const size_t leaf) {
-    cw_assert(leaf != id_obj_manager<trie_node>::INVALID_ID);
-    cw_assert(nodes[leaf]->valid);
+size_t word_domain::update_lai_subsets(const uint32_t leaf) {
+    cw_assert(leaf != TRIE_NO_ID);
+    cw_assert(nodes.word[leaf] != TRIE_NO_ID);
     if constexpr(AssumeFixedSizeWords) {
-        cw_assert(nodes[leaf]->children.size() == 0);
+        cw_assert(nodes.live_mask[leaf] == 0u);
     }
 
-    /**
-     * @brief adds path to reach leaf in trie in forward order, including leaf itself and excluding root node
-    */
-    std::function<void(vector<size_t>&, const size_t)> get_leaf_path;
-    get_leaf_path = [this, &get_leaf_path](vector<size_t>& path, const size_t cur) {
-        if(cur != TRIE_ROOT_NODE_IDX) {
-            cw_assert(cur != id_obj_manager<trie_node>::INVALID_ID);
-            get_leaf_path(path, nodes[cur]->parent);
-            path.push_back(cur);
-        }
-    };
-
-    // get path to leaf node
-    vector<size_t> path;
-    get_leaf_path(path, leaf);
-    cw_assert(path.size() >= MIN_WORD_LEN && path.size() <= MAX_WORD_LEN);
+    // letters on path to reach leaf in trie, in reverse order
+    array<size_t, MAX_WORD_LEN> path;
+    size_t len = 0;
+    for(uint32_t cur = leaf; cur != TRIE_ROOT_NODE_IDX; cur = nodes.parent[cur]) {
+        cw_assert(cur != TRIE_NO_ID);
+        cw_assert(len < MAX_WORD_LEN);
+        path[len++] = static_cast<size_t>(nodes.letter[cur] - 'a');
+    }
+    std::reverse(path.begin(), path.begin() + static_cast<long>(len));
+    cw_assert(len >= MIN_WORD_LEN && len <= MAX_WORD_LEN);
     
     // update lai_subset for each letter/index pair in path
-    for(size_t i = 0; i < path.size(); ++i) {
-        // shorthand
-        const size_t i_idx = i;
-        const size_t i_letter = static_cast<size_t>(nodes[path[i]]->letter - 'a');
-        auto& target = (*letters_at_indices)[i_idx][i_letter].lai_subset;
+    for(size_t i = 0; i < len; ++i) {
+        vector<uint>& target = letters_at_indices[i][path[i]].lai_subset;
 
         // update entry in lai_subset for a letter/index pair
-        for(size_t j = 0; j < path.size(); ++j) {
-            // shorthand
-            const size_t j_idx = j;
-            const size_t j_letter = static_cast<size_t>(nodes[path[j]]->letter - 'a');
-
+        for(size_t j = 0; j < len; ++j) {
             if constexpr(Add) {
-                (*target)[j_idx][j_letter]++;
+                target[letters_table_entry::lai_index(j, path[j])]++;
             } else {
-                cw_assert((*target)[j_idx][j_letter] != 0);
-                (*target)[j_idx][j_letter]--;
+                cw_assert(target[letters_table_entry::lai_index(j, path[j])] != 0);
+                target[letters_table_entry::lai_index(j, path[j])]--;
             }
         }
     }
 
-    return path.size();
+    return len;
 }
 
 /**
@@ -756,16 +1121,25 @@ size_t word_domain::update_lai_subsets(const size_t leaf) {
 word_domain::word_domain(const word_domain& other)
     : common_parent(other.name, other.verbosity),
       filepath_opt(other.filepath_opt),
-      nodes(other.nodes.clone()),
-      word_map(other.word_map),
+      backend(other.backend),
+      nodes(other.nodes),
+      table(other.table),
+      words(other.words),
       unassigned_domain_size(other.unassigned_domain_size),
-      letters_at_indices(other.letters_at_indices ?
-        make_unique<letter_idx_table<letters_table_entry> >(*other.letters_at_indices) : nullptr),
+      letters_at_indices(other.letters_at_indices),
+      leaves_by_rank(other.leaves_by_rank),
+      bitmaps(other.bitmaps),
+      live_words(other.live_words),
+      letter_counts(other.letter_counts),
+      letters_present(other.letters_present),
+      ac3_trie_trail(other.ac3_trie_trail),
+      ac3_block_trail(other.ac3_block_trail),
+      ac3_trail_marks(other.ac3_trail_marks),
       ac3_pruned_assigned_val(other.ac3_pruned_assigned_val),
       assigned(other.assigned),
       assigned_value(other.assigned_value) {
 
-    cw_assert(letters_at_indices);
+    cw_assert(backend == word_domain_backend::TRIE || bitmaps != nullptr);
 }
 word_domain& word_domain::operator=(const word_domain& other) {
     if(this != &other) {
@@ -781,10 +1155,20 @@ word_domain& word_domain::operator=(const word_domain& other) {
 word_domain::word_domain(word_domain&& other) noexcept
     : common_parent(other.name, other.verbosity),
       filepath_opt(std::move(other.filepath_opt)),
+      backend(other.backend),
       nodes(std::move(other.nodes)),
-      word_map(std::move(other.word_map)),
+      table(std::move(other.table)),
+      words(std::move(other.words)),
       unassigned_domain_size(std::move(other.unassigned_domain_size)),
       letters_at_indices(std::move(other.letters_at_indices)),
+      leaves_by_rank(std::move(other.leaves_by_rank)),
+      bitmaps(std::move(other.bitmaps)),
+      live_words(std::move(other.live_words)),
+      letter_counts(std::move(other.letter_counts)),
+      letters_present(std::move(other.letters_present)),
+      ac3_trie_trail(std::move(other.ac3_trie_trail)),
+      ac3_block_trail(std::move(other.ac3_block_trail)),
+      ac3_trail_marks(std::move(other.ac3_trail_marks)),
       ac3_pruned_assigned_val(std::move(other.ac3_pruned_assigned_val)),
       assigned(other.assigned),
       assigned_value(std::move(other.assigned_value)) {
@@ -804,10 +1188,20 @@ void word_domain::swap(word_domain& other) noexcept {
     std::swap(name, other.name);
     std::swap(verbosity, other.verbosity);
     std::swap(filepath_opt, other.filepath_opt);
+    std::swap(backend, other.backend);
     std::swap(nodes, other.nodes);
-    std::swap(word_map, other.word_map);
+    std::swap(table, other.table);
+    std::swap(words, other.words);
     std::swap(unassigned_domain_size, other.unassigned_domain_size);
     std::swap(letters_at_indices, other.letters_at_indices);
+    std::swap(leaves_by_rank, other.leaves_by_rank);
+    std::swap(bitmaps, other.bitmaps);
+    std::swap(live_words, other.live_words);
+    std::swap(letter_counts, other.letter_counts);
+    std::swap(letters_present, other.letters_present);
+    std::swap(ac3_trie_trail, other.ac3_trie_trail);
+    std::swap(ac3_block_trail, other.ac3_block_trail);
+    std::swap(ac3_trail_marks, other.ac3_trail_marks);
     std::swap(ac3_pruned_assigned_val, other.ac3_pruned_assigned_val);
     std::swap(assigned, other.assigned);
     std::swap(assigned_value, other.assigned_value);
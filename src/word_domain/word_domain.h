@@ -11,11 +11,13 @@
 #include "../utils/cw_utils.h"
 #include "word_domain_data_types.h"
 #include "../common/common_parent.h"
+#include "../word_dict/word_dict.h"
 
 using namespace common_data_types_ns;
 using namespace cw;
 using namespace word_domain_data_types_ns;
 using namespace common_parent_ns;
+using namespace word_dict_ns;
 
 namespace word_domain_ns {
     /**
@@ -33,13 +35,19 @@ namespace word_domain_ns {
             word_domain(string name, const optional<std::filesystem::path>& filepath_opt, bool print_progress_bar = false);
 
             // constructor with set of domain, exclusively for cw_variable domain representation
-            word_domain(string name, unordered_set<word_t>&& domain);
+            word_domain(string name, unordered_set<word_t>&& domain, word_domain_backend backend = DEFAULT_WORD_DOMAIN_BACKEND);
+
+            // constructor with ids of words interned in a shared table, exclusively for cw_variable domain representation
+            word_domain(string name, shared_ptr<const word_dict> table, vector<word_id_t>&& domain, word_domain_backend backend = DEFAULT_WORD_DOMAIN_BACKEND);
 
             // add word to trie
             void add_word(word_t w); 
 
+            // add many words to trie at once
+            void add_words(const vector<word_t>& new_words);
+
             // word check
-            bool is_word(string& word) const;
+            bool is_word(const string& word) const;
 
             // find all words that match a pattern
             unordered_set<word_t> find_matches(const string& pattern) const;
@@ -50,19 +58,28 @@ namespace word_domain_ns {
             // read function for entries in letters_at_indices given a specific letter at a specific index
             letter_bitset_t has_letters_at_index_with_letter_assigned(uint index, const letter_bitset_t& letters, uint required_index, char required_letter) const;
 
-            // deletion function for words with letters at an index
+            // deletion function for words with a letter at an index
             size_t remove_matching_words(uint index, char letter);
 
+            // deletion function for words with any of a set of letters at an index
+            size_t remove_matching_words(uint index, const letter_bitset_t& letters);
+
+            // deletion function for a single word
+            size_t remove_word(word_id_t id);
+
             // start new AC-3 algorithm call
-            // i.e. add new blank layer to letters_at_indices.ac3_pruned_nodes and ac3_pruned_assigned_val
+            // i.e. mark current end of trail and add new blank layer to ac3_pruned_assigned_val
             void start_new_ac3_call();
 
             // undo previous AC-3 algorithm call
-            // i.e. pop top layers of letters_at_indices.ac3_pruned_nodes and ac3_pruned_assigned_val, and restore to trie and assigned_value
+            // i.e. undo and pop trail records since the last mark and pop top layer of ac3_pruned_assigned_val, restoring trie and assigned_value
             size_t undo_prev_ac3_call();
 
             // assign domain to a single value, repeat calls overwrite assigned value
-            void assign_domain(word_t new_value) { assigned = true; assigned_value = new_value; }
+            void assign_domain(word_id_t new_value) { assigned = true; assigned_value = new_value; }
+
+            // assign domain to a single value by contents, interning it if needed
+            void assign_domain(const word_t& new_value) { assign_domain(intern(new_value)); }
 
             // unassign domain, restoring the preivous trie, used when all values fail in backtracking
             void unassign_domain() { assigned = false; assigned_value.reset(); }
@@ -70,20 +87,75 @@ namespace word_domain_ns {
             // get assigned status
             bool is_assigned() const { return assigned; }
 
+            // get assigned value, empty if not assigned or if pruned since assigned
+            optional<word_id_t> get_assigned_value() const { return assigned ? assigned_value : std::nullopt; }
+
             // get size of domain remaining, for ac3 validity checking
             size_t size() const;
 
             // get letters at an index, for AC-3 constraint satisfaction checking
             letter_bitset_t get_all_letters_at_index(uint index) const;
 
-            // get all words in current domain to try to assign for backtracking
+            /**
+             * @brief range of ids of words in the current domain in increasing rank in get_table(), generated lazily without allocating
+             * @warning the words remaining in the domain must be the same at each increment as at the start of iteration, 
+             *          e.g. in backtracking, where the assignment and AC-3 calls made for each candidate are undone before the next
+            */
+            class ranked_domain {
+                public:
+                    class iterator {
+                        public:
+                            using value_type = word_id_t;
+                            using difference_type = std::ptrdiff_t;
+
+                            iterator(const word_domain* domain, bool over_assigned) 
+                                : domain(domain), over_assigned(over_assigned), pos(domain->next_ranked(0ul, over_assigned)) {}
+
+                            word_id_t operator*() const { return domain->ranked_id(pos, over_assigned); }
+                            iterator& operator++() { pos = domain->next_ranked(pos + 1, over_assigned); return *this; }
+                            void operator++(int) { ++*this; }
+                            bool operator==(std::default_sentinel_t) const { return pos >= domain->ranked_end(over_assigned); }
+
+                        private:
+                            const word_domain* domain;
+                            bool over_assigned;
+                            size_t pos;
+                    };
+
+                    explicit ranked_domain(const word_domain& domain) : domain(&domain), over_assigned(domain.assigned) {}
+                    iterator begin() const { return iterator(domain, over_assigned); }
+                    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+                private:
+                    const word_domain* domain;
+
+                    // whether domain was assigned at the start of iteration, later assignments are ignored
+                    bool over_assigned;
+            };
+
+            // get ids of all words in current domain in increasing rank, lazily, to try to assign for backtracking
+            ranked_domain get_cur_domain_ranked() const { return ranked_domain(*this); }
+
+            // get ids of all words in current domain
+            vector<word_id_t> get_cur_domain_ids() const;
+
+            // append ids of all words in current domain to acc, for callers reusing a buffer
+            void append_cur_domain_ids(vector<word_id_t>& acc) const;
+
+            // get all words in current domain, for printing and testing
             vector<word_t> get_cur_domain() const;
 
-            // expose letters_at_indicies for testing
-            letter_idx_table<letters_table_entry> get_letters_at_indices() const { cw_assert(letters_at_indices); return *letters_at_indices; }
+            // table of interned words that ids of this domain refer to
+            const word_dict& get_table() const { return *table; }
+
+            // get backend used to track remaining words
+            word_domain_backend get_backend() const { return backend; }
 
-            // expose word_map for testing, undefined if domain assigned
-            unordered_map<string, word_t>& get_word_map() { return word_map; }
+            // expose letters_at_indicies for testing, only num_words meaningful for BITSET backend
+            letter_idx_table<letters_table_entry> get_letters_at_indices() const;
+
+            // expose all words ever added for testing, even if pruned or this domain is assigned a value
+            vector<word_t> get_all_words() const;
 
             // copyable
             word_domain(const word_domain& other);
@@ -106,42 +178,102 @@ namespace word_domain_ns {
             // opt file that this object may have read from
             optional<std::filesystem::path> filepath_opt;
 
-            // all trie nodes
-            id_obj_manager<trie_node> nodes;
+            // data structure used to track remaining words
+            word_domain_backend backend;
+
+            // all trie nodes, rebuilt whenever words are added
+            trie_pool nodes;
+
+            // id 0 of nodes defined as root node
+            static constexpr uint32_t TRIE_ROOT_NODE_IDX = 0u;
 
-            // idx 0 of nodes id_obj_manager defined as root node
-            static constexpr size_t TRIE_ROOT_NODE_IDX = 0ul;
+            // interned words, either a dictionary shared by all domains of a cw_csp or private to this domain
+            // every id held by this domain refers to this table
+            shared_ptr<const word_dict> table;
 
-            // map of all words to word structs (with heuristics) for O(1) validity checking & struct lookup for find_matches()
+            // ids of all words ever added in lexicographic order, indexed by trie_pool::word and by bit of live_words
             // contents include all words ever added, even if pruned during an AC-3 call or this domain is assigned a value
-            unordered_map<string, word_t> word_map;
+            vector<word_id_t> words;
 
             // number of words currently in domain, ignoring any assigned value
             size_t unassigned_domain_size;
 
-            // stores # of words with letters at each index
-            // contents undefined if domain assigned
-            unique_ptr<letter_idx_table<letters_table_entry> > letters_at_indices;
+            // stores # of words with letters at each index, with one row per index of the longest word in domain
+            // contents undefined if domain assigned, empty if BITSET backend
+            letters_table letters_at_indices;
+
+            // ids of trie nodes terminating words in increasing rank of their words, empty if BITSET backend
+            vector<uint32_t> leaves_by_rank;
+
+            // words with each letter at each index, numbered as in words, null if TRIE backend
+            shared_ptr<const letter_bitmaps> bitmaps;
+
+            // bit set iff word with that id remains in domain, empty if TRIE backend
+            vector<word_block_t> live_words;
+
+            // for BITSET backend, # of remaining words with each letter at each index, indexed by letters_table_entry::lai_index()
+            // empty if TRIE backend, which counts them in letters_at_indices instead
+            vector<uint> letter_counts;
+
+            // bit set iff some remaining word has that letter at that index, one bitset per index below the longest word in domain
+            // kept in sync with letters_at_indices or letter_counts, contents undefined if domain assigned
+            vector<letter_bitset_t> letters_present;
+
+            // for TRIE backend, all updates made by remove_matching_words() since the first AC-3 call still in progress, in order
+            vector<trie_trail_entry> ac3_trie_trail;
+
+            // for BITSET backend, {block idx, bits cleared} for every block pruned since the first AC-3 call still in progress, in order
+            vector<pair<size_t, word_block_t> > ac3_block_trail;
+
+            // size of the backend's trail at the start of each AC-3 call still in progress
+            // top layer corresponds to most recent AC-3 call
+            vector<size_t> ac3_trail_marks;
 
             // each layer corresponds to one call to AC-3 algorithm, and possibly contains a pruned assigned value 
             // top layer corresponds to most recent AC-3 call
-            stack<optional<word_t> > ac3_pruned_assigned_val;
+            stack<optional<word_id_t> > ac3_pruned_assigned_val;
 
             // true iff domain has been assigned to a single value --> ignore trie
             bool assigned;
 
             // meaningful iff assigned true, if doesn't have value, then domain is empty
-            optional<word_t> assigned_value;
+            optional<word_id_t> assigned_value;
+
+            // helper to get id of word, replacing table with a private copy that includes word if it is absent
+            word_id_t intern(const word_t& w);
+
+            // helper to add words to words and rebuild, returns true iff any was not yet in words
+            bool insert_words(const vector<word_t>& new_words);
+
+            // helper to replace table with a private copy that also includes words absent from it, remapping all ids held
+            void extend_table(const vector<word_t>& absent);
+
+            // helper to rebuild trie and letters_at_indices, or bitmaps, from words
+            void build_domain();
+
+            // helpers for build_domain() to rebuild each backend from words
+            void build_trie();
+            void build_bitmaps();
+
+            // helper to update a count of remaining words with letter at index, and letters_present if it crosses zero
+            template <bool Add>
+            void update_letter_count(uint& count, size_t index, size_t letter, uint num_words);
+
+            // helper for TRIE backend to remove children of a live node with doomed letters at index & their subtrees
+            uint remove_trie_children(uint32_t parent, uint32_t doomed, uint index);
 
-            // helper for filepath constructor to detect file type
-            static bool has_suffix(const string& str, const string& suffix);
+            // helper for BITSET backend to update letter_counts given addition/removal of a word from active domain
+            template <bool Add>
+            void update_letter_counts(size_t bit);
 
-            // helper for filepath constructor to check if word is legal
-            optional<string> parse_word(const string& word);
+            // helpers for ranked_domain to find remaining words in ranked order
+            size_t next_ranked(size_t pos, bool over_assigned) const;
+            word_id_t ranked_id(size_t pos, bool over_assigned) const;
+            size_t ranked_end(bool over_assigned) const;
 
             // helper to update lai_subset in letters_at_indices given a root trie node
             template <bool Add, bool AssumeFixedSizeWords>
-            size_t update_lai_subsets(const size_t leaf);
+            size_t update_lai_subsets(const uint32_t leaf);
     }; // word_domain
 
     // friend declarations
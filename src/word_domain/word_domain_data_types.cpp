@@ -9,63 +9,66 @@
 using namespace word_domain_data_types_ns;
 
 /**
- * @brief explicitly copy underlying node object
- * 
- * @return ptr to deep copy of node
+ * @brief remove all nodes from trie_pool
 */
-unique_ptr<trie_node> trie_node::clone() const { 
-    return make_unique<trie_node>(*this);
+void trie_pool::clear() {
+    child_mask.clear();
+    live_mask.clear();
+    first_child.clear();
+    parent.clear();
+    letter.clear();
+    word.clear();
+    depth_begin.clear();
 }
 
 /**
- * @brief copy constructor for letters_table_entry
+ * @brief append a node without children or a terminating word to trie_pool
+ * @pre nodes are appended breadth first, i.e. no node is appended at a lower depth than the previous node
+ * 
+ * @param p id of parent node, TRIE_NO_ID if root
+ * @param l letter of edge from parent to this node
+ * @return id of new node
 */
-letters_table_entry::letters_table_entry(const letters_table_entry& other) 
-    : num_words(other.num_words),
-      nodes(other.nodes),
-      ac3_pruned_nodes(other.ac3_pruned_nodes),
-      ac3_pruned_words(other.ac3_pruned_words),
-      lai_subset(make_unique<letter_idx_table<uint> >(*other.lai_subset)) {
-    // do nothing else
-}
+uint32_t trie_pool::push_back(uint32_t p, char l) {
+    cw_assert(size() < TRIE_NO_ID);
 
-/**
- * @brief copy assignment for letters_table_entry
-*/
-letters_table_entry& letters_table_entry::operator=(const letters_table_entry& other) {
-    if(this != &other) {
-        num_words = other.num_words;
-        nodes = other.nodes;
-        ac3_pruned_nodes = other.ac3_pruned_nodes;
-        ac3_pruned_words = other.ac3_pruned_words;
-        lai_subset = make_unique<letter_idx_table<uint> >(*other.lai_subset);
-    }
-    return *this;
-}
+    // first node past the deepest depth so far starts a new depth
+    const size_t depth = p == TRIE_NO_ID ? 0ul : static_cast<size_t>(std::upper_bound(depth_begin.begin(), depth_begin.end(), p) - depth_begin.begin());
+    cw_assert(depth + 1 >= depth_begin.size());
+    if(depth == depth_begin.size()) depth_begin.push_back(static_cast<uint32_t>(size()));
 
-/**
- * @brief move constructor for letters_table_entry
-*/
-letters_table_entry::letters_table_entry(letters_table_entry&& other) noexcept 
-    : num_words(other.num_words),
-      nodes(std::move(other.nodes)),
-      ac3_pruned_nodes(std::move(other.ac3_pruned_nodes)),
-      ac3_pruned_words(std::move(other.ac3_pruned_words)),
-      lai_subset(std::move(other.lai_subset)) {
-    // do nothing else
+    child_mask.push_back(0u);
+    live_mask.push_back(0u);
+    first_child.push_back(TRIE_NO_ID);
+    parent.push_back(p);
+    letter.push_back(l);
+    word.push_back(TRIE_NO_ID);
+    return static_cast<uint32_t>(size() - 1);
 }
 
 /**
- * @brief move assignment for letters_table_entry
+ * @brief build letter_bitmaps over a list of equal length words, numbering words in increasing rank
+ * 
+ * @param table interned words that ids in words refer to
+ * @param words ids of all words of the domain, word i of bitmaps is words[order[i]]
+ * @param word_len length of every word
 */
-letters_table_entry& letters_table_entry::operator=(letters_table_entry&& other) noexcept {
-    letters_table_entry temp(std::move(other));
-
-    std::swap(num_words, temp.num_words);
-    std::swap(nodes, temp.nodes);
-    std::swap(ac3_pruned_nodes, temp.ac3_pruned_nodes);
-    std::swap(ac3_pruned_words, temp.ac3_pruned_words);
-    std::swap(lai_subset, temp.lai_subset);
+letter_bitmaps::letter_bitmaps(const word_dict& table, const vector<word_id_t>& words, size_t word_len) 
+    : word_len(word_len),
+      num_blocks((words.size() + WORD_BLOCK_BITS - 1) / WORD_BLOCK_BITS),
+      blocks(word_len * NUM_ENGLISH_LETTERS * num_blocks, 0ul),
+      order(words.size()) {
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&table, &words](uint32_t lhs, uint32_t rhs) { 
+        return table.get_rank(words[lhs]) < table.get_rank(words[rhs]); 
+    });
 
-    return *this;
+    for(size_t bit = 0; bit < words.size(); ++bit) {
+        const string_view word = table.get_str(words[order[bit]]);
+        cw_assert(word.size() == word_len);
+        for(size_t i = 0; i < word_len; ++i) {
+            const size_t letter = static_cast<size_t>(word[i] - 'a');
+            blocks[(i * NUM_ENGLISH_LETTERS + letter) * num_blocks + bit / WORD_BLOCK_BITS] |= 1ul << (bit % WORD_BLOCK_BITS);
+        }
+    }
 }
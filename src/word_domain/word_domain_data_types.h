@@ -9,9 +9,11 @@
 
 #include "../common/common_data_types.h"
 #include "../utils/cw_utils.h"
+#include "../word_dict/word_dict.h"
 
 using namespace common_data_types_ns;
 using namespace cw;
+using namespace word_dict_ns;
 
 namespace word_domain_data_types_ns {
 
@@ -23,24 +25,144 @@ namespace word_domain_data_types_ns {
     using letter_idx_table = array<array<T, NUM_ENGLISH_LETTERS>, MAX_WORD_LEN>;
 
     /**
-     * @brief node for word_domain
+     * @brief data structure a word_domain uses to track which of its words remain
     */
-    struct trie_node {
-        size_t id; // for id_obj_manager
-        bool valid; // true iff this node terminates a valid word
-        char letter;
-
-        // idx in id_obj_manager of parent, id_obj_manager::INVALID_ID if is root
-        size_t parent;
-
-        // maps next letters -> idx of child trie node in id_obj_manager
-        unordered_map<char, size_t> children;
-        
-        // for explicitly copying unique_ptr to a node by copying underlying object
-        unique_ptr<trie_node> clone() const;
-
-        // constructor to initialize new words/head
-        trie_node(size_t id, bool v, char l, size_t p) : id(id), valid(v), letter(l), parent(p) {}
+    enum class word_domain_backend {
+        TRIE,   // reference implementation, supports words of any length
+        BITSET, // bitmap of remaining words per letter/index pair, only supports words of equal length
+    };
+
+    // backend for cw_variable domains, build with -D CW_TRIE_DOMAINS to use the reference trie instead
+#ifdef CW_TRIE_DOMAINS
+    static constexpr word_domain_backend DEFAULT_WORD_DOMAIN_BACKEND = word_domain_backend::TRIE;
+#else
+    static constexpr word_domain_backend DEFAULT_WORD_DOMAIN_BACKEND = word_domain_backend::BITSET;
+#endif
+
+    // one block of a word bitmap, word i of a domain is bit (i % 64) of block (i / 64)
+    using word_block_t = uint64_t;
+    static constexpr size_t WORD_BLOCK_BITS = 64ul;
+
+    // placeholder for absent trie nodes and for trie nodes that do not terminate a word
+    static constexpr uint32_t TRIE_NO_ID = UINT32_MAX;
+
+    /**
+     * @brief pool of all nodes of a word_domain trie, stored as structure of arrays indexed by node id
+     * @note nodes are numbered breadth first, so each depth is contiguous and the children of each node are contiguous and in letter order
+     * @note the shape of the trie is fixed once built, pruning/restoring only clears/sets bits in live_mask
+    */
+    struct trie_pool {
+        // bit i set iff child with letter 'a' + i exists, whether or not it is currently pruned
+        vector<uint32_t> child_mask;
+
+        // bit i set iff child with letter 'a' + i exists and has not been pruned
+        vector<uint32_t> live_mask;
+
+        // id of child with lowest letter, meaningless if child_mask is 0
+        vector<uint32_t> first_child;
+
+        // id of parent node, TRIE_NO_ID if root
+        vector<uint32_t> parent;
+
+        // letter of edge from parent to this node
+        vector<char> letter;
+
+        // index of word terminating at this node in word_domain::words, or TRIE_NO_ID
+        vector<uint32_t> word;
+
+        // id of first node at each depth, root defined as depth 0
+        vector<uint32_t> depth_begin;
+
+        // number of nodes in pool
+        size_t size() const { return parent.size(); }
+
+        // remove all nodes
+        void clear();
+
+        // append node with no children, returns its id
+        uint32_t push_back(uint32_t p, char l);
+
+        // ids of all nodes at depth, as [first, last)
+        pair<uint32_t, uint32_t> depth_range(size_t depth) const {
+            if(depth >= depth_begin.size()) return {0u, 0u};
+            return {depth_begin[depth], depth + 1 < depth_begin.size() ? depth_begin[depth + 1] : static_cast<uint32_t>(size())};
+        }
+
+        // id of existing child of node with letter, or TRIE_NO_ID if none was ever built
+        uint32_t child(uint32_t node, char l) const {
+            const uint32_t bit = 1u << static_cast<uint>(l - 'a');
+            if(!(child_mask[node] & bit)) return TRIE_NO_ID;
+            return first_child[node] + static_cast<uint32_t>(std::popcount(child_mask[node] & (bit - 1u)));
+        }
+
+        // true iff the edge from this node's parent to it has not been pruned
+        bool is_live(uint32_t node) const {
+            return parent[node] == TRIE_NO_ID || (live_mask[parent[node]] & (1u << static_cast<uint>(letter[node] - 'a')));
+        }
+    };
+
+    /**
+     * @brief immutable bitmaps of which words of an equal length word_domain have each letter at each index
+     * @note never modified after construction, so shared by all copies of a domain
+     * @note words are numbered by rank in their word_dict rather than by id, see order
+    */
+    struct letter_bitmaps {
+        // length of every word
+        size_t word_len;
+
+        // number of blocks per bitmap
+        size_t num_blocks;
+
+        // word_len * NUM_ENGLISH_LETTERS bitmaps of num_blocks blocks each, ordered by index then letter
+        vector<word_block_t> blocks;
+
+        // index in word_domain::words of the word numbered by each bit, in increasing rank so set bits are visited in rank order
+        // positions rather than ids, so they stay valid when the ids of a domain are remapped
+        vector<uint32_t> order;
+
+        // build bitmaps over words interned in table, numbered by position in words
+        letter_bitmaps(const word_dict& table, const vector<word_id_t>& words, size_t word_len);
+
+        // start of bitmap of words with letter at index
+        const word_block_t* at(size_t index, size_t letter) const {
+            cw_assert(index < word_len && letter < NUM_ENGLISH_LETTERS);
+            return blocks.data() + (index * NUM_ENGLISH_LETTERS + letter) * num_blocks;
+        }
+    };
+
+    // true iff bitmaps a & b & c share any set bit
+    inline bool blocks_intersect(const word_block_t* a, const word_block_t* b, const word_block_t* c, size_t num_blocks) {
+        for(size_t i = 0; i < num_blocks; ++i) {
+            if(a[i] & b[i] & c[i]) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief record of one update to the trie or letters_at_indices made by remove_matching_words(), for undo_prev_ac3_call() to reverse
+     * 
+     * @note why only pruned nodes are recorded to restore trie structure:
+     * ---
+     * after calls to remove_matching_words(), all the nodes removed from the trie are the nodes of 0 or more subtrees which 
+     * are branches chopped off of the original trie. thus, if a node has been removed from the main trie, it is guaranteed 
+     * that its connection, an edge from its parent node to itself, has been removed. vice versa, if a node's connection to its 
+     * child node has been removed, by the description of the behavior of remove_matching_words(), it is guaranteed that the 
+     * child node is no longer part of the trie. thus, the function from nodes removed from the trie to their parents from which 
+     * their incoming edge has been removed is one-to-one. therefore it is sufficient to record only the removed nodes since the 
+     * trie_pool stores the parent of every node, which is not deleted in calls to remove_matching_words(). during the restore 
+     * call, we can simply restore all the removed nodes recorded since the start of the AC-3 call, and for each node, set the bit 
+     * in its parent's live_mask to restore the edge pointing to formerly removed node. since each restore only sets a single bit, 
+     * records may be undone in any order
+     * 
+     * note: overlap between the removed node set and parent node set is permitted iff all parent nodes (themselves removed or not) 
+     * remove edges to all their removed children, which indeed is the case. also notice that under these conditions, all the removed 
+     * nodes have no connections to one another
+    */
+    struct trie_trail_entry {
+        uint32_t node;      // node whose letters_at_indices entry was updated
+        uint32_t num_words; // number of words removed from that entry
+        uint8_t index;      // depth of node, i.e. index of its letter in words
+        bool pruned;        // true iff edge from parent to node was removed, each node is pruned at most once per AC-3 call
     };
 
     /**
@@ -50,50 +172,26 @@ namespace word_domain_data_types_ns {
         // number of words with a specific letter at a specific index
         uint num_words;
 
-        // idx for all nodes that currently match this specific letter and index
-        unordered_set<size_t> nodes;
-
-        /**
-         * for these two functions below, each layer corresponds to one call to AC-3 algorithm, top layer corresponds to most recent AC-3 call
-         * 
-         * @note why only ac3_pruned_nodes used to restore trie structure:
-         * ---
-         * after calls to remove_matching_words(), all the nodes removed from the trie are the nodes of 0 or more subtrees which 
-         * are branches chopped off of the original trie. thus, if a node has been removed from the main trie, it is guaranteed 
-         * that its connection, an edge from its parent node to itself, has been removed. vice versa, if a node's connection to its 
-         * child node has been removed, by the description of the behavior of remove_matching_words(), it is guaranteed that the 
-         * child node is no longer part of the trie. thus, the function from nodes removed from the trie to their parents from which 
-         * their incoming edge has been removed is one-to-one. therefore it is sufficient to store only a set of removed nodes since the 
-         * node datatype stores an idx to their parent which is not deleted in calls to remove_matching_words(). during the restore 
-         * call, we can simply restore all the removed nodes in the top layer of ac3_pruned_nodes, and for each node, access their parent 
-         * to restore the edge pointing to formerly removed node. 
-         * 
-         * note: overlap between the removed node set and parent node set is permitted iff all parent nodes (themselves removed or not) 
-         * remove edges to all their removed children, which indeed is the case. also notice that under these conditions, all the removed 
-         * nodes have no connections to one another
-        */
-        // contains nodes pruned during an AC-3 call
-        stack<unordered_set<size_t> > ac3_pruned_nodes;
-        // number of words pruned during an AC-3 call
-        stack<uint> ac3_pruned_words;
+        // number of nodes with this specific letter at this specific index that are currently live
+        uint num_nodes;
 
-        // subset of letters_at_indices.num_words entries for all words with this specific letter at a specific index
-        unique_ptr<letter_idx_table<uint> > lai_subset;
+        // ids of all nodes with this specific letter at this specific index, live or not, in increasing order
+        vector<uint32_t> nodes;
 
-        // for copying, must deep copy lai_subset
-        letters_table_entry(const letters_table_entry& other);
-        letters_table_entry& operator=(const letters_table_entry& other);
+        // subset of letters_at_indices.num_words entries for all words with this specific letter at a specific index
+        // one count per letter per index below the longest word length of the domain, see lai_index()
+        vector<uint> lai_subset;
 
-        // moving ok
-        letters_table_entry(letters_table_entry&& other) noexcept;
-        letters_table_entry& operator=(letters_table_entry&& other) noexcept;
-        
-        // default destructor ok with unique_ptr
-        ~letters_table_entry() = default;
+        // base constructors, sized for a domain whose longest word has word_len letters
+        letters_table_entry() : num_words(0u), num_nodes(0u) {}
+        explicit letters_table_entry(size_t word_len) : num_words(0u), num_nodes(0u), lai_subset(word_len * NUM_ENGLISH_LETTERS, 0u) {}
 
-        // base constructor
-        letters_table_entry() : num_words(0u), lai_subset(make_unique<letter_idx_table<uint> >()) {}
+        // index in lai_subset of the count for a letter at an index
+        static size_t lai_index(size_t index, size_t letter) { return index * NUM_ENGLISH_LETTERS + letter; }
     };
+
+    // letters_at_indices sized to a domain, one row per index below the longest word length of the domain
+    using letters_table = vector<array<letters_table_entry, NUM_ENGLISH_LETTERS> >;
 }; // word_domain_data_types_ns
 
 #endif // WORD_DOMAIN_DATA_TYPES_H
\ No newline at end of file
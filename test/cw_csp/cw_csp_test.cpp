@@ -719,29 +719,27 @@ TEST_CASE("cw_csp ac3_valid_constraint_duplicates", "[cw_csp],[ac3],[ac3_validit
     const std::filesystem::path dict_single_word = "cw_csp/data/dict_single_word.txt";
     const std::filesystem::path dict_simple_path = "cw_csp/data/dict_simple.txt";
 
-    // ############### valid crosswords ###############
+    // ############### invalid crosswords ###############
 
     // simple crossword that requires duplicates
-    // note: while this is an illegal configuration, word_domain cannot detect variables in a 
-    //  constraint using the same word so it cannot detect that this is illegal, so expected is true
+    // 4 variables of length 2 share only 2 words between them, which AC-3 detects as a Hall set without pruning any domain,
+    // so it is checked through solving rather than through the domains AC-3 leaves
     stringstream contents_2_2_duplicate_invalid;
     contents_2_2_duplicate_invalid << WCD << WCD
                                    << WCD << WCD;
-    REQUIRE(dut->test_ac3_validity(2, 2, contents_2_2_duplicate_invalid.str(), dict_single_word, true));
-
-    // valid 6x7 crossword with complex intersections & mix of wildcards and letters
-    // forces two words to both be 'cat', but is allowed due to same reason as above
-    stringstream contents_6_7_complex_valid;
-    contents_6_7_complex_valid << WCD << BLK << BLK << WCD << BLK << 'p' 
-                               << 't' << WCD << WCD << 'e' << BLK << BLK 
-                               << WCD << BLK << BLK << WCD << WCD << WCD 
-                               << WCD << BLK << WCD << BLK << BLK << BLK 
-                               << BLK << BLK << WCD << BLK << WCD << WCD 
-                               << WCD << 'a' << 't' << BLK << BLK << BLK 
-                               << BLK << 'n' << BLK << WCD << 'a' << 't';
-    REQUIRE(dut->test_ac3_validity(6, 7, contents_6_7_complex_valid.str(), dict_simple_path, true));
+    REQUIRE(dut->test_backtracking_validity(2, 2, contents_2_2_duplicate_invalid.str(), dict_single_word, false, false));
 
-    // ############### invalid crosswords ###############
+    // 6x7 crossword with complex intersections & mix of wildcards and letters
+    // forces two words to both be 'cat', so is invalid once AC-3 narrows both their domains to it
+    stringstream contents_6_7_complex_duplicate;
+    contents_6_7_complex_duplicate << WCD << BLK << BLK << WCD << BLK << 'p' 
+                                   << 't' << WCD << WCD << 'e' << BLK << BLK 
+                                   << WCD << BLK << BLK << WCD << WCD << WCD 
+                                   << WCD << BLK << WCD << BLK << BLK << BLK 
+                                   << BLK << BLK << WCD << BLK << WCD << WCD 
+                                   << WCD << 'a' << 't' << BLK << BLK << BLK 
+                                   << BLK << 'n' << BLK << WCD << 'a' << 't';
+    REQUIRE(dut->test_ac3_validity(6, 7, contents_6_7_complex_duplicate.str(), dict_simple_path, false));
 
     // invalid 6x7 crossword with complex intersections & mix of wildcards and letters
     stringstream contents_6_7_complex_invalid;
@@ -985,6 +983,323 @@ TEST_CASE("cw_csp backtracking_valid_check", "[cw_csp],[backtracking],[quick]")
     REQUIRE(dut->test_backtracking_validity(4, 4, contents_4_4_empty.str(), dict_1000, false, true));
 }
 
+/**
+ * backtracking solving tests for cw_csp with every variable ordering & seeded tiebreaks, as raced by a cw_tree portfolio
+*/
+TEST_CASE("cw_csp backtracking_orderings", "[cw_csp],[backtracking],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp backtracking_orderings");
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+    const std::filesystem::path dict_nytimes_8_28_23 = "cw_csp/data/dict_nytimes_8_28_23.txt";
+
+    // ############### valid crosswords ###############
+
+    // 5x5 nytimes crossword 8/28/2023
+    stringstream contents_nytimes_8_28_23;
+    contents_nytimes_8_28_23 << BLK << WCD << WCD << WCD << WCD 
+                             << BLK << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << BLK 
+                             << WCD << WCD << WCD << WCD << BLK;
+    REQUIRE(dut->test_backtracking_orderings(5, 5, contents_nytimes_8_28_23.str(), dict_nytimes_8_28_23, true));
+
+    // 4x4 diamond crossword
+    stringstream contents_4_4_diamond;
+    contents_4_4_diamond << BLK << WCD << WCD << WCD 
+                         << WCD << WCD << WCD << WCD 
+                         << WCD << WCD << WCD << WCD
+                         << WCD << WCD << WCD << BLK; 
+    REQUIRE(dut->test_backtracking_orderings(4, 4, contents_4_4_diamond.str(), dict_1000, true));
+
+    // 5x5 diamond crossword
+    stringstream contents_5_5_diamond;
+    contents_5_5_diamond << BLK << BLK << BLK << WCD << WCD 
+                         << BLK << BLK << WCD << WCD << WCD 
+                         << BLK << WCD << WCD << WCD << BLK 
+                         << WCD << WCD << WCD << BLK << BLK 
+                         << WCD << WCD << BLK << BLK << BLK;
+    REQUIRE(dut->test_backtracking_orderings(5, 5, contents_5_5_diamond.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // empty 4x4 crossword
+    stringstream contents_4_4_empty;
+    contents_4_4_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_backtracking_orderings(4, 4, contents_4_4_empty.str(), dict_1000, false));
+}
+
+/**
+ * parallel backtracking solving tests for cw_csp, with the search tree split among threads
+*/
+TEST_CASE("cw_csp parallel_backtracking", "[cw_csp],[backtracking],[parallel],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp parallel_backtracking");
+    const std::filesystem::path dict_barebones_path = "cw_csp/data/dict_barebones.txt";
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+    const std::filesystem::path dict_nytimes_2_3_17 = "cw_csp/data/dict_nytimes_2_3_17.txt";
+
+    // ############### valid crosswords ###############
+
+    // 5x5 nytimes crossword 2/3/17
+    stringstream contents_nytimes_2_3_17;
+    contents_nytimes_2_3_17 << BLK << BLK << WCD << WCD << WCD 
+                            << BLK << WCD << WCD << WCD << WCD
+                            << WCD << WCD << WCD << WCD << WCD 
+                            << WCD << WCD << WCD << WCD << WCD 
+                            << WCD << WCD << WCD << WCD << BLK;
+    REQUIRE(dut->test_parallel_backtracking(5, 5, contents_nytimes_2_3_17.str(), dict_nytimes_2_3_17, true));
+
+    // empty 4x3 crossword
+    stringstream contents_4_3_empty;
+    contents_4_3_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD; 
+    REQUIRE(dut->test_parallel_backtracking(4, 3, contents_4_3_empty.str(), dict_1000, true));
+
+    // 4x4 donut crossword
+    stringstream contents_4_4_donut;
+    contents_4_4_donut << WCD << WCD << WCD << WCD 
+                       << WCD << BLK << BLK << WCD 
+                       << WCD << BLK << BLK << WCD
+                       << WCD << WCD << WCD << WCD; 
+    REQUIRE(dut->test_parallel_backtracking(4, 4, contents_4_4_donut.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // initially invalid 4x3 crossword
+    stringstream contents_4_3_invalid;
+    contents_4_3_invalid << 'x' << 'y' << WCD << 'z'
+                         << WCD << WCD << WCD << WCD 
+                         << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_parallel_backtracking(4, 3, contents_4_3_invalid.str(), dict_1000, false));
+
+    // 3x3 donut crossword, w/ barebones dict
+    stringstream contents_3_3_donut;
+    contents_3_3_donut << WCD << WCD << WCD 
+                       << WCD << BLK << WCD 
+                       << WCD << WCD << WCD ;
+    REQUIRE(dut->test_parallel_backtracking(3, 3, contents_3_3_donut.str(), dict_barebones_path, false));
+
+    // empty 4x4 crossword, exhausting the whole search tree
+    stringstream contents_4_4_empty;
+    contents_4_4_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_parallel_backtracking(4, 4, contents_4_4_empty.str(), dict_1000, false));
+}
+
+/**
+ * backtracking solving tests for cw_csp with randomized restarts
+*/
+TEST_CASE("cw_csp restarts", "[cw_csp],[backtracking],[restarts],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp restarts");
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+    const std::filesystem::path dict_nytimes_8_28_23 = "cw_csp/data/dict_nytimes_8_28_23.txt";
+
+    // ############### valid crosswords ###############
+
+    // 5x5 nytimes crossword 8/28/2023
+    stringstream contents_nytimes_8_28_23;
+    contents_nytimes_8_28_23 << BLK << WCD << WCD << WCD << WCD 
+                             << BLK << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << BLK 
+                             << WCD << WCD << WCD << WCD << BLK;
+    REQUIRE(dut->test_restarts(5, 5, contents_nytimes_8_28_23.str(), dict_nytimes_8_28_23, true));
+
+    // 5x5 diamond crossword
+    stringstream contents_5_5_diamond;
+    contents_5_5_diamond << BLK << BLK << BLK << WCD << WCD 
+                         << BLK << BLK << WCD << WCD << WCD 
+                         << BLK << WCD << WCD << WCD << BLK 
+                         << WCD << WCD << WCD << BLK << BLK 
+                         << WCD << WCD << BLK << BLK << BLK;
+    REQUIRE(dut->test_restarts(5, 5, contents_5_5_diamond.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // empty 4x4 crossword, exhausted only once a run's budget covers the whole search tree
+    stringstream contents_4_4_empty;
+    contents_4_4_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_restarts(4, 4, contents_4_4_empty.str(), dict_1000, false));
+}
+
+/**
+ * min-conflicts local search solving tests for cw_csp
+*/
+TEST_CASE("cw_csp local_search", "[cw_csp],[local_search],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp local_search");
+    const std::filesystem::path dict_barebones_path = "cw_csp/data/dict_barebones.txt";
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+    const std::filesystem::path dict_nytimes_8_28_23 = "cw_csp/data/dict_nytimes_8_28_23.txt";
+
+    REQUIRE(dut->test_min_conflicts_fill(dict_barebones_path));
+
+    // ############### valid crosswords ###############
+
+    // 5x5 nytimes crossword 8/28/2023
+    stringstream contents_nytimes_8_28_23;
+    contents_nytimes_8_28_23 << BLK << WCD << WCD << WCD << WCD 
+                             << BLK << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << WCD 
+                             << WCD << WCD << WCD << WCD << BLK 
+                             << WCD << WCD << WCD << WCD << BLK;
+    REQUIRE(dut->test_local_search(5, 5, contents_nytimes_8_28_23.str(), dict_nytimes_8_28_23, true));
+
+    // empty 4x3 crossword
+    stringstream contents_4_3_empty;
+    contents_4_3_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD; 
+    REQUIRE(dut->test_local_search(4, 3, contents_4_3_empty.str(), dict_1000, true));
+
+    // 4x4 donut crossword
+    stringstream contents_4_4_donut;
+    contents_4_4_donut << WCD << WCD << WCD << WCD 
+                       << WCD << BLK << BLK << WCD 
+                       << WCD << BLK << BLK << WCD
+                       << WCD << WCD << WCD << WCD; 
+    REQUIRE(dut->test_local_search(4, 4, contents_4_4_donut.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // initially invalid 4x3 crossword
+    stringstream contents_4_3_invalid;
+    contents_4_3_invalid << 'x' << 'y' << WCD << 'z'
+                         << WCD << WCD << WCD << WCD 
+                         << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_local_search(4, 3, contents_4_3_invalid.str(), dict_1000, false));
+
+    // 3x3 donut crossword, w/ barebones dict, never filled without conflicts
+    stringstream contents_3_3_donut;
+    contents_3_3_donut << WCD << WCD << WCD 
+                       << WCD << BLK << WCD 
+                       << WCD << WCD << WCD ;
+    REQUIRE(dut->test_local_search(3, 3, contents_3_3_donut.str(), dict_barebones_path, false));
+}
+
+/**
+ * large neighbourhood search solving tests for cw_csp
+*/
+TEST_CASE("cw_csp lns", "[cw_csp],[lns],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp lns");
+    const std::filesystem::path dict_barebones_path = "cw_csp/data/dict_barebones.txt";
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+    const std::filesystem::path dict_nytimes_2_3_17 = "cw_csp/data/dict_nytimes_2_3_17.txt";
+
+    // ############### valid crosswords ###############
+
+    // 5x5 nytimes crossword 2/3/17
+    stringstream contents_nytimes_2_3_17;
+    contents_nytimes_2_3_17 << BLK << BLK << WCD << WCD << WCD 
+                            << BLK << WCD << WCD << WCD << WCD
+                            << WCD << WCD << WCD << WCD << WCD 
+                            << WCD << WCD << WCD << WCD << WCD 
+                            << WCD << WCD << WCD << WCD << BLK;
+    REQUIRE(dut->test_lns(5, 5, contents_nytimes_2_3_17.str(), dict_nytimes_2_3_17, true));
+
+    // 4x4 diamond crossword beside 5x5 diamond crossword
+    stringstream contents_diamonds;
+    contents_diamonds << BLK << WCD << WCD << WCD << BLK << BLK << BLK << BLK << WCD << WCD
+                      << WCD << WCD << WCD << WCD << BLK << BLK << BLK << WCD << WCD << WCD
+                      << WCD << WCD << WCD << WCD << BLK << BLK << WCD << WCD << WCD << BLK
+                      << WCD << WCD << WCD << BLK << BLK << WCD << WCD << WCD << BLK << BLK
+                      << BLK << BLK << BLK << BLK << BLK << WCD << WCD << BLK << BLK << BLK;
+    REQUIRE(dut->test_lns(10, 5, contents_diamonds.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // 3x3 donut crossword, w/ barebones dict
+    stringstream contents_3_3_donut;
+    contents_3_3_donut << WCD << WCD << WCD 
+                       << WCD << BLK << WCD 
+                       << WCD << WCD << WCD ;
+    REQUIRE(dut->test_lns(3, 3, contents_3_3_donut.str(), dict_barebones_path, false));
+
+    // empty 4x4 crossword, proven invalid by a search with nothing fixed or no fixed assignment in conflict
+    stringstream contents_4_4_empty;
+    contents_4_4_empty << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD 
+                       << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_lns(4, 4, contents_4_4_empty.str(), dict_1000, false));
+}
+
+/**
+ * backtracking solving tests for cw_csp on grids of independent regions, where backjumping skips assignments unrelated to a failure
+*/
+TEST_CASE("cw_csp backjumping", "[cw_csp],[backtracking],[backjumping],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp backjumping");
+    const std::filesystem::path dict_1000 = "cw_csp/data/words_top1000.txt";
+
+    // ############### valid crosswords ###############
+
+    // 4x4 diamond crossword beside 5x5 diamond crossword
+    stringstream contents_diamonds;
+    contents_diamonds << BLK << WCD << WCD << WCD << BLK << BLK << BLK << BLK << WCD << WCD
+                      << WCD << WCD << WCD << WCD << BLK << BLK << BLK << WCD << WCD << WCD
+                      << WCD << WCD << WCD << WCD << BLK << BLK << WCD << WCD << WCD << BLK
+                      << WCD << WCD << WCD << BLK << BLK << WCD << WCD << WCD << BLK << BLK
+                      << BLK << BLK << BLK << BLK << BLK << WCD << WCD << BLK << BLK << BLK;
+    REQUIRE(dut->test_backtracking_orderings(10, 5, contents_diamonds.str(), dict_1000, true));
+    REQUIRE(dut->test_parallel_backtracking(10, 5, contents_diamonds.str(), dict_1000, true));
+
+    // ############### invalid crosswords ###############
+
+    // 4x4 diamond crossword beside empty 4x4 crossword
+    stringstream contents_diamond_and_empty;
+    contents_diamond_and_empty << BLK << WCD << WCD << WCD << BLK << WCD << WCD << WCD << WCD
+                               << WCD << WCD << WCD << WCD << BLK << WCD << WCD << WCD << WCD
+                               << WCD << WCD << WCD << WCD << BLK << WCD << WCD << WCD << WCD
+                               << WCD << WCD << WCD << BLK << BLK << WCD << WCD << WCD << WCD;
+    REQUIRE(dut->test_backtracking_orderings(9, 4, contents_diamond_and_empty.str(), dict_1000, false));
+    REQUIRE(dut->test_parallel_backtracking(9, 4, contents_diamond_and_empty.str(), dict_1000, false));
+    REQUIRE(dut->test_backjumping(9, 4, contents_diamond_and_empty.str(), dict_1000, false));
+}
+
+/**
+ * nogood store tests for cw_csp
+*/
+TEST_CASE("cw_csp nogood_store", "[cw_csp],[nogoods],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp nogood_store");
+    REQUIRE(dut->test_nogood_store());
+}
+
+/**
+ * variable ordering tests for cw_csp
+*/
+TEST_CASE("cw_csp dom_wdeg_heap", "[cw_csp],[orderings],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp dom_wdeg_heap");
+    REQUIRE(dut->test_dom_wdeg_heap());
+}
+
+/**
+ * value ordering tests for cw_csp
+*/
+TEST_CASE("cw_csp lcv", "[cw_csp],[orderings],[quick]") {
+    cw_csp_test_driver* dut = new cw_csp_test_driver("cw_csp lcv");
+    const std::filesystem::path dict_barebones_path = "cw_csp/data/dict_barebones.txt";
+
+    REQUIRE(dut->test_lcv_candidates());
+
+    // 3x3 donut crossword, whose across words share their first & last letters with the first & last letters of down words
+    stringstream contents_3_3_donut;
+    contents_3_3_donut << WCD << WCD << WCD 
+                       << WCD << BLK << WCD 
+                       << WCD << WCD << WCD;
+
+    // top: "and" leaves 2 down words starting with "a" & 2 with "d", all others wipe out a down word
+    REQUIRE(dut->test_least_constraining_values(3, 3, contents_3_3_donut.str(), dict_barebones_path, 0, 0, ACROSS, {"and"}));
+
+    // bottom: "dab" leaves 1 down word ending in "d" & 3 ending in "b", ahead of "dan" leaving 1 & 2 ending in "n"
+    REQUIRE(dut->test_least_constraining_values(3, 3, contents_3_3_donut.str(), dict_barebones_path, 2, 0, ACROSS, {"dab", "dan"}));
+}
+
 /**
  * large backtracking solving tests for cw_csp for valid/invalid checking
 */
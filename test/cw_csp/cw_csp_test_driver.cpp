@@ -257,3 +257,497 @@ bool cw_csp_test_driver::test_backtracking_validity(uint length, uint height, st
     }
     return result;
 }
+
+/**
+ * @brief test that every variable ordering, value ordering & tiebreak seed agrees with default backtracking on solvability, and that a stopped search fails
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving with any ordering
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_backtracking_orderings(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_backtracking_orderings(): " << length << ", " << height << " cw";
+    dut_name << name << " test_backtracking_orderings(): " << length << ", " << height;
+
+    bool result = true;
+
+    for(const var_ordering var_order : {MRV, MRV_DEGREE, DOM_WDEG}) {
+        for(const val_ordering val_order : {HIGH_SCORE_AND_FREQ, LCV, LCV_SCORE}) {
+            for(const uint64_t seed : {0ul, 1ul, 2ul}) {
+                dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+                dut->set_seed(seed);
+
+                stringstream condition;
+                condition << dut_name.str() << " backtracking validity with " << basic_json(var_order) << ", " << basic_json(val_order) << ", seed " << seed;
+                result &= check_condition(condition.str(), dut->solve(BACKTRACKING, var_order, val_order) == expected_result);
+            }
+        }
+    }
+
+    // search stopped before it starts
+    dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+    dut->set_stop_flag(make_shared<const std::atomic<bool> >(true));
+    result &= check_condition(dut_name.str() + " stopped", !dut->solve(BACKTRACKING, MRV, HIGH_SCORE_AND_FREQ));
+
+    return result;
+}
+
+/**
+ * @brief test that parallel backtracking with any number of threads agrees with backtracking on solvability, and leaves the csp solved
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_parallel_backtracking(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_parallel_backtracking(): " << length << ", " << height << " cw";
+    dut_name << name << " test_parallel_backtracking(): " << length << ", " << height;
+
+    bool result = true;
+
+    for(const size_t num_threads : {1ul, 2ul, 4ul}) {
+        dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+        dut->set_num_threads(num_threads);
+
+        stringstream condition;
+        condition << dut_name.str() << " parallel backtracking validity with " << num_threads << " threads";
+        result &= check_condition(condition.str(), dut->solve(PARALLEL_BACKTRACKING, MRV, HIGH_SCORE_AND_FREQ) == expected_result);
+        result &= check_condition(condition.str() + " solved", dut->solved() == expected_result);
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that backtracking with restarts agrees with backtracking on solvability under every variable ordering,
+ * & finds the same solution when run again with the same seed
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_restarts(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_restarts(): " << length << ", " << height << " cw";
+    dut_name << name << " test_restarts(): " << length << ", " << height;
+
+    bool result = true;
+
+    // restart budgets follow the Luby sequence
+    const vector<size_t> expected_luby = {1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, 1};
+    for(size_t i = 0; i < expected_luby.size(); ++i) {
+        result &= check_condition(dut_name.str() + " luby " + std::to_string(i + 1), luby(i + 1) == expected_luby[i]);
+    }
+
+    for(const var_ordering var_order : {MRV, MRV_DEGREE, DOM_WDEG}) {
+        for(const uint64_t seed : {1ul, 2ul, 3ul}) {
+            stringstream condition;
+            condition << dut_name.str() << " restarts validity with " << basic_json(var_order) << ", seed " << seed;
+
+            optional<string> solution;
+            for(uint run = 0; run < 2; ++run) {
+                dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+                dut->set_seed(seed);
+                result &= check_condition(condition.str(), dut->solve(RESTARTS, var_order, HIGH_SCORE_AND_FREQ) == expected_result);
+                result &= check_condition(condition.str() + " solved", dut->solved() == expected_result);
+
+                // same seed, same solution
+                if(expected_result && solution.has_value()) {
+                    result &= check_condition(condition.str() + " reproducible", dut->result() == solution.value());
+                } else if(expected_result) {
+                    solution = dut->result();
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that backtracking solves the crossword iff expected, & jumps back past some search step unrelated to a failure,
+ *        per its trace. chronological backtracking only ever returns to the search step directly above, so never passes this.
+ *        MRV orderings are used since they fill the smaller domains of an independent region first, which a failure elsewhere
+ *        must then jump back past
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_backjumping(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_backjumping(): " << length << ", " << height << " cw";
+    dut_name << name << " test_backjumping(): " << length << ", " << height;
+    const std::filesystem::path trace_path = std::filesystem::temp_directory_path() / ("cw_csp_backjumping_" + std::to_string(getpid()) + ".json");
+
+    bool result = true;
+
+    for(const var_ordering var_order : {MRV, MRV_DEGREE}) {
+        stringstream condition;
+        condition << dut_name.str() << " backjumping with " << basic_json(var_order);
+
+        dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, true);
+        result &= check_condition(condition.str() + " validity", dut->solve(BACKTRACKING, var_order, HIGH_SCORE_AND_FREQ) == expected_result);
+
+        ordered_json trace;
+        dut->save_trace_result(trace_path);
+        std::ifstream(trace_path) >> trace;
+
+        // search steps returning past a level not in conflict, or exhausting their domain with a jump over more than one level
+        size_t num_jumps = 0ul;
+        std::function<void(const ordered_json&)> count_jumps = [&](const ordered_json& span) {
+            if(span.at("type").get<ts_type_t>() == TS_CSP_SEARCH_STEP) {
+                const ordered_json& r = span.at("result");
+                if(r.value("reason", "") == "backjumped" || (r.contains("jump_height") && r.at("jump_height").is_number() && r.at("jump_height").get<size_t>() > 1ul)) {
+                    ++num_jumps;
+                }
+            }
+            for(const ordered_json& child : span.at("children")) {
+                count_jumps(child);
+            }
+        };
+        count_jumps(trace);
+        result &= check_condition(condition.str() + " jumped", num_jumps > 0ul);
+    }
+    std::filesystem::remove(trace_path);
+
+    return result;
+}
+
+/**
+ * @brief test that local search fills the crossword iff expected, leaving the csp solved, & never fills an invalid crossword
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_local_search(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_local_search(): " << length << ", " << height << " cw";
+    dut_name << name << " test_local_search(): " << length << ", " << height;
+
+    bool result = true;
+
+    for(const uint64_t seed : {0ul, 1ul, 2ul}) {
+        dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+        dut->set_seed(seed);
+
+        stringstream condition;
+        condition << dut_name.str() << " local search validity with seed " << seed;
+        result &= check_condition(condition.str(), dut->solve(LOCAL_SEARCH, MRV, HIGH_SCORE_AND_FREQ) == expected_result);
+        result &= check_condition(condition.str() + " solved", dut->solved() == expected_result);
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that large neighbourhood search agrees with backtracking on solvability under every variable ordering
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param expected_result the expected result of solving
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_lns(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_lns(): " << length << ", " << height << " cw";
+    dut_name << name << " test_lns(): " << length << ", " << height;
+
+    bool result = true;
+
+    for(const var_ordering var_order : {MRV, MRV_DEGREE, DOM_WDEG}) {
+        for(const uint64_t seed : {0ul, 1ul, 2ul}) {
+            dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+            dut->set_seed(seed);
+
+            stringstream condition;
+            condition << dut_name.str() << " lns validity with " << basic_json(var_order) << ", seed " << seed;
+            result &= check_condition(condition.str(), dut->solve(LNS, var_order, HIGH_SCORE_AND_FREQ) == expected_result);
+            result &= check_condition(condition.str() + " solved", dut->solved() == expected_result);
+
+            // failure leaves no assignment behind, as failed backtracking from the same root does
+            if(!expected_result) {
+                cw_csp reference(dut_name.str() + " reference", crossword(cw_name.str(), length, height, contents), filepath, false, false);
+                result &= check_condition(condition.str() + " reference", !reference.solve(BACKTRACKING, var_order, HIGH_SCORE_AND_FREQ));
+                result &= check_condition(condition.str() + " grid restored", dut->get_grid() == reference.get_grid());
+
+                unordered_map<unique_ptr<cw_variable>, unordered_set<word_t> > result_var_domains;
+                unordered_map<unique_ptr<cw_variable>, unordered_set<word_t> > expected_var_domains;
+                for(const auto& var : dut->get_variables()) {
+                    vector<word_t> domain_vec = var->domain.get_cur_domain();
+                    result_var_domains.insert(std::make_pair(var->clone(), unordered_set<word_t>(domain_vec.begin(), domain_vec.end())));
+                }
+                for(const auto& var : reference.get_variables()) {
+                    vector<word_t> domain_vec = var->domain.get_cur_domain();
+                    expected_var_domains.insert(std::make_pair(var->clone(), unordered_set<word_t>(domain_vec.begin(), domain_vec.end())));
+                }
+                result &= check_condition(condition.str() + " var domains restored", map_to_set_contents_equal(result_var_domains, expected_var_domains, true));
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that a nogood_store finds nogoods only once completed by a candidate, & evicts by the clock policy once full
+ * 
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_nogood_store() {
+    bool result = true;
+
+    // assignments currently made, for checking whether nogoods are completed
+    vector<csp_assignment> made;
+    auto holds = [&made](const csp_assignment& a) {
+        return std::ranges::any_of(made, [&a](const csp_assignment& m) { return m.var == a.var && m.word == a.word; });
+    };
+
+    nogood_store store(2ul, 3ul);
+    result &= check_condition(name + " empty nogood", !store.learn({}, 1ul));
+    result &= check_condition(name + " nogood too large", !store.learn({{0ul, 0u}, {1ul, 1u}, {2ul, 2u}, {3ul, 3u}}, 1ul));
+
+    // only found once all other assignments of the nogood are made, & only for the same variable
+    result &= check_condition(name + " learn", store.learn({{0ul, 10u}, {1ul, 11u}}, 5ul));
+    result &= check_condition(name + " incomplete nogood", store.find({1ul, 11u}, holds) == nullptr);
+    made = {{0ul, 10u}};
+    result &= check_condition(name + " completed nogood", store.find({1ul, 11u}, holds) != nullptr);
+    result &= check_condition(name + " other variable", store.find({2ul, 11u}, holds) == nullptr);
+    result &= check_condition(name + " unknown word", store.find({1ul, 12u}, holds) == nullptr);
+
+    // once full, the nogood hit is spared & the oldest one not hit is evicted
+    result &= check_condition(name + " learn unary", store.learn({{2ul, 20u}}, 1ul));
+    result &= check_condition(name + " learn when full", store.learn({{3ul, 30u}}, 1ul));
+    result &= check_condition(name + " spared nogood", store.find({1ul, 11u}, holds) != nullptr);
+    result &= check_condition(name + " evicted nogood", store.find({2ul, 20u}, holds) == nullptr);
+    result &= check_condition(name + " newest nogood", store.find({3ul, 30u}, holds) != nullptr);
+
+    // counters
+    result &= check_condition(name + " learned", store.stats().learned == 3ul);
+    result &= check_condition(name + " hits", store.stats().hits == 3ul);
+    result &= check_condition(name + " evicted", store.stats().evicted == 1ul);
+    result &= check_condition(name + " time saved", store.stats().time_saved_us == 11ul);
+
+    return result;
+}
+
+/**
+ * @brief test that a min_conflicts_fill counts conflicts at crossing tiles & repeated words as words are replaced
+ * 
+ * @param filepath the relative filepath to a dictionary containing "cat", "cab", "cup", & "dan"
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_min_conflicts_fill(const std::filesystem::path& filepath) {
+    bool result = true;
+
+    shared_ptr<const word_dict> dict = word_dict::load(filepath);
+    const word_id_t cat = dict->find_id("cat").value();
+    const word_id_t cab = dict->find_id("cab").value();
+    const word_id_t cup = dict->find_id("cup").value();
+    const word_id_t dan = dict->find_id("dan").value();
+
+    // 2 variables sharing their first letter
+    min_conflicts_fill fill(dict, {{{ .index = 0, .other = 1, .other_index = 0 }}, {{ .index = 0, .other = 0, .other_index = 0 }}});
+    result &= check_condition(name + " empty", fill.total_conflicts() == 0ul && !fill.complete() && !fill.word_of(0).has_value());
+
+    // unfilled variables conflict with nothing
+    fill.set_word(0, cat);
+    result &= check_condition(name + " partial", fill.total_conflicts() == 0ul && !fill.complete() && fill.word_of(0) == cat);
+    result &= check_condition(name + " cost match", fill.cost(1, cup) == 0ul);
+    result &= check_condition(name + " cost mismatch", fill.cost(1, dan) == 1ul);
+    result &= check_condition(name + " cost repeat", fill.cost(1, cat) == 1ul);
+
+    // conflicts counted for both variables & undone once replaced
+    fill.set_word(1, dan);
+    result &= check_condition(name + " mismatch", fill.complete() && fill.total_conflicts() == 1ul && fill.conflicts_of(0) == 1ul && fill.conflicts_of(1) == 1ul);
+    fill.set_word(1, cab);
+    result &= check_condition(name + " solved", fill.total_conflicts() == 0ul && fill.conflicts_of(0) == 0ul && fill.conflicts_of(1) == 0ul);
+    fill.set_word(1, cat);
+    result &= check_condition(name + " repeat", fill.total_conflicts() == 1ul && fill.conflicts_of(0) == 1ul && fill.conflicts_of(1) == 1ul);
+    result &= check_condition(name + " cost own word", fill.cost(1, cat) == 1ul && fill.cost(1, cab) == 0ul);
+    fill.set_word(0, cup);
+    result &= check_condition(name + " repeat resolved", fill.total_conflicts() == 0ul && fill.word_of(0) == cup && fill.word_of(1) == cat);
+
+    // 3 variables in a row, the middle one sharing its first letter with the first & its last letter with the last
+    min_conflicts_fill row(dict, {
+        {{ .index = 0, .other = 1, .other_index = 0 }},
+        {{ .index = 0, .other = 0, .other_index = 0 }, { .index = 2, .other = 2, .other_index = 0 }},
+        {{ .index = 0, .other = 1, .other_index = 2 }}
+    });
+    std::mt19937_64 rng(1ul);
+    auto draws = [&rng](const std::function<size_t(std::mt19937_64&)>& pick) {
+        set<size_t> picked;
+        for(uint i = 0; i < 64; ++i) {
+            picked.insert(pick(rng));
+        }
+        return picked;
+    };
+    auto most = [&row](std::mt19937_64& r) { return row.most_conflicted(r); };
+    auto any  = [&row](std::mt19937_64& r) { return row.any_conflicted(r); };
+
+    // middle variable conflicts with both ends
+    row.set_word(0, cat);
+    row.set_word(1, dan);
+    row.set_word(2, cup);
+    result &= check_condition(name + " row conflicts", row.total_conflicts() == 2ul && row.conflicts_of(1) == 2ul);
+    result &= check_condition(name + " row most conflicted", draws(most) == set<size_t>{1ul});
+    result &= check_condition(name + " row any conflicted", draws(any) == set<size_t>{0ul, 1ul, 2ul});
+
+    // first conflict resolved, ties between the last two
+    row.set_word(1, cab);
+    result &= check_condition(name + " row most conflicted tie", row.total_conflicts() == 1ul && draws(most) == set<size_t>{1ul, 2ul});
+    result &= check_condition(name + " row any conflicted tie", draws(any) == set<size_t>{1ul, 2ul});
+
+    // repeat of the first word conflicts with it again
+    row.set_word(1, cat);
+    result &= check_condition(name + " row most conflicted repeat", row.total_conflicts() == 2ul && draws(most) == set<size_t>{1ul});
+
+    return result;
+}
+
+/**
+ * @brief test that a dom_wdeg_heap selects the variable of least domain size over weighted degree as keys change
+ * 
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_dom_wdeg_heap() {
+    bool result = true;
+
+    // ties broken by reverse id
+    dom_wdeg_heap heap(vector<uint64_t>{3ul, 2ul, 1ul, 0ul});
+    result &= check_condition(name + " empty", heap.empty());
+    heap.insert(0ul, 4ul);
+    heap.insert(1ul, 4ul);
+    heap.insert(2ul, 6ul);
+    heap.insert(3ul, 8ul);
+    result &= check_condition(name + " tiebreak", heap.top() == 1ul);
+
+    // smaller domain
+    heap.set_dom(3ul, 2ul);
+    result &= check_condition(name + " smaller domain", heap.top() == 3ul);
+
+    // weighted degree 4 beats domain 2 / weighted degree 1
+    heap.add_wdeg(2ul, 3ul);
+    result &= check_condition(name + " weighted degree", heap.top() == 2ul);
+
+    // keys kept while out of heap
+    heap.erase(2ul);
+    result &= check_condition(name + " erase", !heap.contains(2ul) && heap.top() == 3ul);
+    heap.set_dom(2ul, 12ul);
+    heap.insert(2ul, 4ul);
+    result &= check_condition(name + " reinsert", heap.top() == 2ul);
+
+    // larger domain
+    heap.set_dom(2ul, 40ul);
+    heap.set_dom(3ul, 40ul);
+    result &= check_condition(name + " larger domain", heap.top() == 1ul);
+
+    heap.erase(1ul);
+    heap.erase(0ul);
+    heap.erase(3ul);
+    heap.erase(2ul);
+    result &= check_condition(name + " emptied", heap.empty());
+
+    return result;
+}
+
+/**
+ * @brief test that lcv_candidates returns every candidate in order of descending key, then ascending tiebreak, across
+ *        more chunks than the first
+ * 
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_lcv_candidates() {
+    bool result = true;
+
+    // keys with many ties, & distinct tiebreaks in a different order than keys
+    const size_t num_candidates = 8 * LCV_CHUNK_SIZE + 3;
+    lcv_candidates candidates;
+    vector<tuple<double, uint64_t, word_id_t> > expected;
+    for(size_t i = 0; i < num_candidates; ++i) {
+        const double key = static_cast<double>((i * 37) % 11);
+        const uint64_t tiebreak = (i * 53) % num_candidates;
+        candidates.push(key, tiebreak, static_cast<word_id_t>(i));
+        expected.emplace_back(-key, tiebreak, static_cast<word_id_t>(i));
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for(size_t i = 0; i < num_candidates; ++i) {
+        const optional<word_id_t> next = candidates.next();
+        result &= check_condition(name + " candidate " + std::to_string(i), next == std::get<2>(expected[i]));
+    }
+    result &= check_condition(name + " exhausted", !candidates.next().has_value());
+
+    return result;
+}
+
+/**
+ * @brief test that an LCV ordering tries the words of a variable leaving the most words in crossing variables first
+ * 
+ * @param length the length of the crossword
+ * @param height the height of the crossword
+ * @param contents the contents of the crossword
+ * @param filepath the relative filepath to the dictionary of words file
+ * @param origin_row row of first tile of variable to order
+ * @param origin_col column of first tile of variable to order
+ * @param dir direction of variable to order
+ * @param expected_prefix first words expected in order
+ * @return true iff successful
+*/
+bool cw_csp_test_driver::test_least_constraining_values(uint length, uint height, string contents, const std::filesystem::path& filepath,
+                                                        uint origin_row, uint origin_col, word_direction dir, const vector<string>& expected_prefix) {
+    stringstream cw_name;
+    stringstream dut_name;
+    cw_name  << name << " test_least_constraining_values(): " << length << ", " << height << " cw";
+    dut_name << name << " test_least_constraining_values(): " << length << ", " << height;
+
+    bool result = true;
+    dut = make_unique<cw_csp>(dut_name.str(), crossword(cw_name.str(), length, height, contents), filepath, false, false);
+
+    optional<size_t> var;
+    unordered_set<string> domain;
+    for(const unique_ptr<cw_variable>& v : dut->get_variables()) {
+        if(v->origin_row == origin_row && v->origin_col == origin_col && v->dir == dir) {
+            var = v->id;
+            for(const word_t& w : v->domain.get_cur_domain()) {
+                domain.insert(w.word);
+            }
+        }
+    }
+    result &= check_condition(dut_name.str() + " variable found", var.has_value());
+    if(!var.has_value()) {
+        return false;
+    }
+
+    const vector<string> order = dut->get_lcv_order(var.value(), LCV);
+    result &= check_condition(dut_name.str() + " every word once", order.size() == domain.size() && unordered_set<string>(order.begin(), order.end()) == domain);
+    result &= check_condition(dut_name.str() + " least constraining first", order.size() >= expected_prefix.size() && std::equal(expected_prefix.begin(), expected_prefix.end(), order.begin()));
+
+    return result;
+}
@@ -41,6 +41,26 @@ namespace cw_csp_test_driver_ns {
 
             // csp solving w/ backtracking test
             bool test_backtracking_validity(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result, bool do_print);
+            bool test_backtracking_orderings(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+            bool test_parallel_backtracking(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+            bool test_backjumping(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+            bool test_restarts(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+            bool test_local_search(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+            bool test_lns(uint length, uint height, string contents, const std::filesystem::path& filepath, bool expected_result);
+
+            // nogood learning tests
+            bool test_nogood_store();
+
+            // variable ordering tests
+            bool test_dom_wdeg_heap();
+
+            // value ordering tests
+            bool test_lcv_candidates();
+            bool test_least_constraining_values(uint length, uint height, string contents, const std::filesystem::path& filepath,
+                                                uint origin_row, uint origin_col, word_direction dir, const vector<string>& expected_prefix);
+
+            // local search tests
+            bool test_min_conflicts_fill(const std::filesystem::path& filepath);
 
         private:
             unique_ptr<cw_csp> dut;
@@ -0,0 +1,60 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: Catch2 tests for word_dict class
+// ==================================================================
+
+#include "../catch/catch.hpp"
+#include "word_dict_test_driver.h"
+
+using namespace word_dict_test_driver_ns;
+
+/**
+ * hello world test for word_dict
+*/
+TEST_CASE("word_dict hello_world", "[word_dict],[hello_world],[quick]") {
+    REQUIRE(true);
+}
+
+/**
+ * test that a dictionary is parsed once and shared by all requests for it
+*/
+TEST_CASE("word_dict load_shared", "[word_dict],[quick]") {
+    shared_ptr<word_dict_test_driver> driver = make_shared<word_dict_test_driver>("word_dict_test_driver-load_shared");
+
+    REQUIRE(driver->test_load_shared("word_domain/data/data_small.json", "./word_domain/../word_domain/data/data_small.json", 8));
+    REQUIRE(driver->test_load_shared("cw_csp/data/words_top1000.txt", "cw_csp/data/../data/words_top1000.txt", 4));
+}
+
+/**
+ * test that find_matches() matches that of word_domain
+*/
+TEST_CASE("word_dict find_matches", "[word_dict],[quick]") {
+    shared_ptr<word_dict_test_driver> driver = make_shared<word_dict_test_driver>("word_dict_test_driver-find_matches");
+    const vector<string> patterns = {"?", "??", "???", "h????", "?h?", "?u?", "ca?", "??b", "?????y????", "zzz", "the", "?????", "????s", "?a??e", "s?a?e", "a1?", ""};
+
+    REQUIRE(driver->test_find_matches("word_domain/data/data_small.json", patterns));
+    REQUIRE(driver->test_find_matches("cw_csp/data/words_top1000.txt", patterns));
+}
+
+/**
+ * test that word ids are interned consistently with word_t lookups
+*/
+TEST_CASE("word_dict interned_ids", "[word_dict],[quick]") {
+    shared_ptr<word_dict_test_driver> driver = make_shared<word_dict_test_driver>("word_dict_test_driver-interned_ids");
+    const vector<string> patterns = {"?", "??", "???", "h????", "?h?", "?u?", "ca?", "??b", "?????y????", "zzz", "the", "?????", "????s", "?a??e", "s?a?e", "a1?", ""};
+
+    REQUIRE(driver->test_interned_ids("word_domain/data/data_small.json", patterns));
+    REQUIRE(driver->test_interned_ids("cw_csp/data/words_top1000.txt", patterns));
+}
+
+/**
+ * test that compiled images are mapped in place of their source files only when fresh and compatible
+*/
+TEST_CASE("word_dict compiled_image", "[word_dict],[quick]") {
+    shared_ptr<word_dict_test_driver> driver = make_shared<word_dict_test_driver>("word_dict_test_driver-compiled_image");
+    const vector<string> patterns = {"?", "??", "???", "h????", "?h?", "?u?", "ca?", "??b", "?????y????", "zzz", "the", "?????", "????s", "?a??e", "s?a?e", "a1?", ""};
+
+    REQUIRE(driver->test_compiled_image("word_domain/data/data_small.json", patterns));
+    REQUIRE(driver->test_compiled_image("cw_csp/data/words_top1000.txt", patterns));
+}
\ No newline at end of file
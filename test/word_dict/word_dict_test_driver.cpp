@@ -0,0 +1,212 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: test driver implementation for word_dict
+// ==================================================================
+
+#include "word_dict_test_driver.h"
+
+#include <thread>
+
+using namespace word_dict_test_driver_ns;
+
+/**
+ * @brief basic constructor for word_dict test driver
+ * 
+ * @param name name of driver
+*/
+word_dict_test_driver::word_dict_test_driver(string name) : common_parent(name, VERBOSITY) {
+    // do nothing
+}
+
+/**
+ * @brief test that word_dict::load() only parses each file once, and shares the result with all callers
+ * 
+ * @param filepath path to dictionary file
+ * @param alt_filepath different path to the same dictionary file
+ * @param num_threads number of threads to concurrently request filepath
+ * @return true iff successful
+*/
+bool word_dict_test_driver::test_load_shared(const std::filesystem::path& filepath, const std::filesystem::path& alt_filepath, uint num_threads) {
+    bool result = true;
+
+    // concurrent first requests
+    vector<shared_ptr<const word_dict> > loaded(num_threads);
+    vector<std::thread> threads;
+    for(uint i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&loaded, &filepath, i]() { loaded[i] = word_dict::load(filepath); });
+    }
+    for(std::thread& t : threads) {
+        t.join();
+    }
+
+    for(uint i = 0; i < num_threads; ++i) {
+        result &= check_condition(name + " thread " + std::to_string(i) + " loaded", loaded[i] != nullptr);
+        result &= check_condition(name + " thread " + std::to_string(i) + " shared", loaded[i] == loaded[0]);
+    }
+
+    // later requests, including through a different path
+    result &= check_condition(name + " repeat request shared", word_dict::load(filepath) == loaded[0]);
+    result &= check_condition(name + " alternate path shared", word_dict::load(alt_filepath) == loaded[0]);
+
+    return result;
+}
+
+/**
+ * @brief test that find_matches() on a word_dict matches that of a word_domain built from the same file
+ * 
+ * @param filepath path to dictionary file
+ * @param patterns patterns to compare results for
+ * @return true iff successful
+*/
+bool word_dict_test_driver::test_find_matches(const std::filesystem::path& filepath, const vector<string>& patterns) {
+    bool result = true;
+    shared_ptr<const word_dict> dict = word_dict::load(filepath);
+    word_domain ground_truth(name + " ground_truth", filepath);
+
+    result &= check_condition(name + " size", dict->size() == ground_truth.size());
+    for(const string& pattern : patterns) {
+        unordered_set<word_t> expected = ground_truth.find_matches(pattern);
+        unordered_set<word_t> matches = dict->find_matches(pattern);
+        result &= check_condition(name + " find_matches for \"" + pattern + "\"", set_contents_equal(expected, matches, true));
+
+        for(const word_t& w : expected) {
+            result &= check_condition(name + " is_word for \"" + w.word + "\"", dict->is_word(w.word));
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that word ids are dense and in lexicographic order, and that id lookups agree with word_t lookups
+ * 
+ * @param filepath path to dictionary file
+ * @param patterns patterns to compare results for
+ * @return true iff successful
+*/
+bool word_dict_test_driver::test_interned_ids(const std::filesystem::path& filepath, const vector<string>& patterns) {
+    bool result = true;
+    shared_ptr<const word_dict> dict = word_dict::load(filepath);
+
+    for(word_id_t id = 0u; id < static_cast<word_id_t>(dict->size()); ++id) {
+        const word_t w = dict->get_word(id);
+        result &= check_condition(name + " get_str for " + std::to_string(id), dict->get_str(id) == w.word);
+        result &= check_condition(name + " heuristics for " + std::to_string(id), dict->get_score(id) == w.score && dict->get_freq(id) == w.freq);
+        result &= check_condition(name + " find_id for \"" + w.word + "\"", dict->find_id(w.word) == optional<word_id_t>(id));
+        if(id > 0u) {
+            result &= check_condition(name + " lexicographic order at " + std::to_string(id), dict->get_str(id - 1u) < dict->get_str(id));
+        }
+    }
+    result &= check_condition(name + " find_id for non-word", !dict->find_id("qqqqqqqqqq").has_value() && !dict->find_id("a?").has_value());
+
+    // ranks are a permutation ordering words by descending score, then descending freq, then descending id
+    vector<word_id_t> by_rank(dict->size(), static_cast<word_id_t>(dict->size()));
+    for(word_id_t id = 0u; id < static_cast<word_id_t>(dict->size()); ++id) {
+        if(dict->get_rank(id) < by_rank.size()) by_rank[dict->get_rank(id)] = id;
+    }
+    for(size_t r = 0; r < by_rank.size(); ++r) {
+        result &= check_condition(name + " rank " + std::to_string(r) + " assigned", by_rank[r] < dict->size());
+        if(r > 0 && by_rank[r] < dict->size() && by_rank[r - 1] < dict->size()) {
+            const word_id_t prev = by_rank[r - 1], cur = by_rank[r];
+            result &= check_condition(name + " rank order at " + std::to_string(r), 
+                std::make_tuple(dict->get_score(prev), dict->get_freq(prev), prev) > std::make_tuple(dict->get_score(cur), dict->get_freq(cur), cur)
+            );
+        }
+    }
+
+    for(const string& pattern : patterns) {
+        const vector<word_id_t> ids = dict->find_match_ids(pattern);
+        unordered_set<word_t> matches;
+        for(const word_id_t id : ids) {
+            matches.insert(dict->get_word(id));
+        }
+        result &= check_condition(name + " find_match_ids increasing for \"" + pattern + "\"", std::adjacent_find(ids.begin(), ids.end(), std::greater_equal<word_id_t>()) == ids.end());
+        result &= check_condition(name + " find_match_ids for \"" + pattern + "\"", set_contents_equal(dict->find_matches(pattern), matches, true));
+    }
+
+    return result;
+}
+
+/**
+ * @brief test that a compiled image of a dictionary file is mapped and matches the dictionary parsed from that file,
+ *        and that stale or incompatible images are ignored in favor of the source file
+ * 
+ * @param filepath path to dictionary file, copied into a temporary directory so no image is written next to it
+ * @param patterns patterns to compare results for
+ * @return true iff successful
+*/
+bool word_dict_test_driver::test_compiled_image(const std::filesystem::path& filepath, const vector<string>& patterns) {
+    bool result = true;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / ("cw_word_dict_test_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path source = dir / filepath.filename();
+    const std::filesystem::path image = word_dict::image_path(source);
+    std::filesystem::copy_file(filepath, source, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::remove(image);
+
+    // no image yet, must parse
+    word_dict parsed(name + " parsed", source, false);
+    result &= check_condition(name + " parsed without image", !parsed.is_mapped());
+    parsed.save_image(image);
+
+    // fresh image next to source, or image requested directly, must be mapped with identical contents
+    auto same_contents = [&](const word_dict& dict, const string& desc) {
+        result &= check_condition(name + " " + desc + " size", dict.size() == parsed.size());
+        for(const string& pattern : patterns) {
+            result &= check_condition(name + " " + desc + " find_matches for \"" + pattern + "\"", set_contents_equal(parsed.find_matches(pattern), dict.find_matches(pattern), true));
+        }
+    };
+    word_dict via_source(name + " via_source", source, false);
+    word_dict via_image(name + " via_image", image, false);
+    result &= check_condition(name + " mapped via source", via_source.is_mapped());
+    result &= check_condition(name + " mapped via image", via_image.is_mapped());
+    same_contents(via_source, "via_source");
+    same_contents(via_image, "via_image");
+
+    // images of a different version are never mapped
+    {
+        std::fstream image_file(image, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t bad_version = DICT_IMAGE_VERSION + 1;
+        image_file.seekp(static_cast<std::streamoff>(offsetof(dict_image_header, version)));
+        image_file.write(reinterpret_cast<const char*>(&bad_version), sizeof(bad_version));
+    }
+    word_dict bad_version(name + " bad_version", source, false);
+    result &= check_condition(name + " bad version not mapped", !bad_version.is_mapped());
+    same_contents(bad_version, "bad_version");
+
+    // images storing an out of bounds word id, node index, or pool range are never mapped
+    dict_image_header h;
+    parsed.save_image(image);
+    {
+        std::ifstream image_file(image, std::ios::binary);
+        image_file.read(reinterpret_cast<char*>(&h), sizeof(h));
+    }
+    const vector<tuple<string, uint64_t, uint32_t> > corruptions = {
+        {"posting id",  h.postings_offset, h.num_words},
+        {"first child", h.nodes_offset + offsetof(dict_trie_node, first_child), h.num_nodes},
+        {"node word",   h.nodes_offset + offsetof(dict_trie_node, word), h.num_words},
+        {"pool offset", h.words_offset + offsetof(dict_word_entry, pool_offset), h.pool_size}
+    };
+    for(const auto& [desc, offset, value] : corruptions) {
+        parsed.save_image(image);
+        {
+            std::fstream image_file(image, std::ios::binary | std::ios::in | std::ios::out);
+            image_file.seekp(static_cast<std::streamoff>(offset));
+            image_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        word_dict corrupt(name + " corrupt " + desc, source, false);
+        result &= check_condition(name + " corrupt " + desc + " not mapped", !corrupt.is_mapped());
+        same_contents(corrupt, "corrupt " + desc);
+    }
+
+    // images older than their source are never mapped
+    parsed.save_image(image);
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(image) + std::chrono::seconds(1));
+    word_dict stale(name + " stale", source, false);
+    result &= check_condition(name + " stale image not mapped", !stale.is_mapped());
+    same_contents(stale, "stale");
+
+    std::filesystem::remove_all(dir);
+    return result;
+}
\ No newline at end of file
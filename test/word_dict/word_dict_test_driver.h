@@ -0,0 +1,40 @@
+// ==================================================================
+// Author: Ashley Zhang (ayz27@cornell.edu)
+// Date:   10/16/2026
+// Description: test driver declaration for word_dict
+// ==================================================================
+
+#ifndef WORD_DICT_TEST_DRIVER_H
+#define WORD_DICT_TEST_DRIVER_H
+
+#include "../../src/common/common_data_types.h"
+#include "../../src/common/common_parent.h"
+#include "../../src/word_domain/word_domain.h"
+#include "../../src/word_dict/word_dict.h"
+
+using namespace common_data_types_ns;
+using namespace common_parent_ns;
+using namespace word_domain_ns;
+using namespace word_dict_ns;
+
+namespace word_dict_test_driver_ns {
+    class word_dict_test_driver : public common_parent {
+        public:
+            // base constructor
+            word_dict_test_driver(string name);
+
+            // test that all requests for the same file, from any thread or by any relative path, share one dictionary
+            bool test_load_shared(const std::filesystem::path& filepath, const std::filesystem::path& alt_filepath, uint num_threads);
+
+            // test that find_matches() agrees with a word_domain built from the same file
+            bool test_find_matches(const std::filesystem::path& filepath, const vector<string>& patterns);
+
+            // test that word ids are dense, in lexicographic order, and agree with find_matches() and find_id()
+            bool test_interned_ids(const std::filesystem::path& filepath, const vector<string>& patterns);
+
+            // test that a compiled image maps to the same contents as its source, and that bad images are never mapped
+            bool test_compiled_image(const std::filesystem::path& filepath, const vector<string>& patterns);
+    }; // word_dict_test_driver
+} // word_dict_test_driver_ns
+
+#endif // WORD_DICT_TEST_DRIVER_H
@@ -618,10 +618,7 @@ TEST_CASE("word_domain has_letters_at_index_with_letter_assigned-basic", "[word_
 */
 TEST_CASE("word_domain has_letters_at_index_with_letter_assigned-complex", "[word_domain],[quick]") {
     word_domain_test_driver parser("word_domain_test_driver-parser", "word_domain/data/data_small.json");
-    vector<word_t> domain;
-    for(const auto& pair : parser.get_word_map()) {
-        domain.push_back(pair.second);
-    }
+    vector<word_t> domain = parser.get_all_words();
 
     for(uint i = MIN_WORD_LEN; i < MAX_WORD_LEN; ++i) {
         vector<word_t> domain_copy = domain;
@@ -675,3 +672,82 @@ TEST_CASE("word_domain has_letters_at_index_with_letter_assigned-complex", "[wor
         run_test_at_depth(0);
     }
 }
+
+/**
+ * differential test of BITSET backend against TRIE backend for domains of every length
+*/
+TEST_CASE("word_domain backends_equivalent", "[word_domain],[quick]") {
+    word_domain_test_driver parser("word_domain_test_driver-parser", "word_domain/data/data_small.json");
+    unique_ptr<word_domain_test_driver> driver = make_unique<word_domain_test_driver>("word_domain_test_driver-backends_equivalent");
+
+    for(uint i = MIN_WORD_LEN; i < MAX_WORD_LEN; ++i) {
+        vector<word_t> domain;
+        for(const word_t& w : parser.get_all_words()) {
+            if(w.word.size() == i) domain.push_back(w);
+        }
+
+        vector<pair<uint, char> > remove_params = {
+            {static_cast<uint>((97 * domain.size() + 89) % i), static_cast<char>(( 3 * domain.size() +  5) % NUM_ENGLISH_LETTERS + 'a')},
+            {static_cast<uint>((79 * domain.size() + 73) % i), static_cast<char>(( 7 * domain.size() + 11) % NUM_ENGLISH_LETTERS + 'a')},
+            {static_cast<uint>((71 * domain.size() + 67) % i), static_cast<char>((13 * domain.size() + 17) % NUM_ENGLISH_LETTERS + 'a')},
+            {0u, 's'},
+            {static_cast<uint>(i - 1), 'e'},
+            {static_cast<uint>(i / 2), 'a'},
+        };
+
+        REQUIRE(driver->test_backends_equivalent(domain, remove_params));
+    }
+}
+
+
+/**
+ * differential test of removing sets of letters at once against removing each letter separately, for domains of every length
+*/
+TEST_CASE("word_domain remove_matching_words-letters", "[word_domain],[quick]") {
+    word_domain_test_driver parser("word_domain_test_driver-parser", "word_domain/data/data_small.json");
+    unique_ptr<word_domain_test_driver> driver = make_unique<word_domain_test_driver>("word_domain_test_driver-remove_matching_words-letters");
+
+    for(uint i = MIN_WORD_LEN; i < MAX_WORD_LEN; ++i) {
+        vector<word_t> domain;
+        for(const word_t& w : parser.get_all_words()) {
+            if(w.word.size() == i) domain.push_back(w);
+        }
+
+        vector<pair<uint, letter_bitset_t> > remove_params = {
+            {static_cast<uint>((97 * domain.size() + 89) % i), letter_bitset_t((37 * domain.size() + 101) % (1ul << NUM_ENGLISH_LETTERS))},
+            {0u, letter_bitset_t("00000000000000000000010001")},                            // 'a', 'e'
+            {static_cast<uint>(i - 1), letter_bitset_t("00010000001100000000000000")},     // 'o', 'p', 'w'
+            {static_cast<uint>(i / 2), letter_bitset_t()},                                  // none
+            {static_cast<uint>((i + 1) / 3), letter_bitset_t().set()},                      // all
+        };
+
+        REQUIRE(driver->test_remove_letters(domain, remove_params));
+    }
+}
+
+/**
+ * differential test of removing single words, for domains of every length
+*/
+TEST_CASE("word_domain remove_word", "[word_domain],[quick]") {
+    word_domain_test_driver parser("word_domain_test_driver-parser", "word_domain/data/data_small.json");
+    unique_ptr<word_domain_test_driver> driver = make_unique<word_domain_test_driver>("word_domain_test_driver-remove_word");
+
+    for(uint i = MIN_WORD_LEN; i < MAX_WORD_LEN; ++i) {
+        vector<word_t> domain;
+        for(const word_t& w : parser.get_all_words()) {
+            if(w.word.size() == i) domain.push_back(w);
+        }
+
+        REQUIRE(driver->test_remove_word(domain, 1ul + i % 3));
+    }
+}
+
+/**
+ * test for domains of ids interned in a dictionary shared with other domains
+*/
+TEST_CASE("word_domain shared_table", "[word_domain],[quick]") {
+    shared_ptr<word_domain_test_driver> driver = make_shared<word_domain_test_driver>("word_domain_test_driver-shared_table");
+
+    REQUIRE(driver->test_shared_table("word_domain/data/data_small.json", "?????"));
+    REQUIRE(driver->test_shared_table("cw_csp/data/words_top1000.txt", "???"));
+}
\ No newline at end of file
@@ -44,7 +44,7 @@ bool word_domain_test_driver::test_trie_basic(string pattern, unordered_set<word
  * 
  * @param words words to add to trie, in order. size must be equal as num_words_ground_truths, num_nodes_ground_truths
  * @param initial_num_words initial state of num_words in letters_at_indices
- * @param initial_num_nodes initial state of nodes.size() in letters_at_indices
+ * @param initial_num_nodes initial state of num_nodes in letters_at_indices
  * @param num_words_ground_truths expected num_words after each call to add_word(), size must be equal as words, num_nodes_ground_truths
  * @param num_nodes_ground_truths expected size() of children nodes after each call to add_word(), size must be equal as num_words_ground_truths, words
  * @returns true iff letters_at_indices equal to expected at every step 
@@ -102,7 +102,7 @@ bool word_domain_test_driver::test_letters_at_indicies_row_sums(
  * @param init_words words to add at once before removal calls
  * @param remove_params words to remove, in order, size must be equal to num_words_ground_truths, num_nodes_ground_truths
  * @param initial_num_words initial state of num_words in letters_at_indices
- * @param initial_num_nodes initial state of nodes.size() in letters_at_indices
+ * @param initial_num_nodes initial state of num_nodes in letters_at_indices
  * @param num_words_ground_truths expected num_words after each call to remove_matching_words(), size must be equal as remove_params, num_nodes_ground_truths
  * @param num_nodes_ground_truths expected size() of children nodes after each call to remove_matching_words(), size must be equal as num_words_ground_truths, remove_params
  * @returns true iff letters_at_indices equal to expected at every step 
@@ -118,13 +118,13 @@ bool word_domain_test_driver::test_letters_at_indicies_remove(
     cw_assert(remove_params.size() == num_words_ground_truths.size()); 
     cw_assert(num_nodes_ground_truths.size() == num_words_ground_truths.size()); 
 
-    for(word_t word : init_words) dut->add_word(word);
+    dut->add_words(init_words);
     letter_idx_table<letters_table_entry> letters_at_indices = dut->get_letters_at_indices();
 
     result &= check_condition("letters_at_indicies initial num_words", letters_at_indicies_entries_equal(initial_num_words, letters_at_indices, true));
     result &= check_condition("letters_at_indicies initial num nodes", letters_at_indicies_entries_equal(initial_num_nodes, letters_at_indices, false));
 
-    const size_t init_domain_size = dut->get_word_map().size();
+    const size_t init_domain_size = dut->get_all_words().size();
     size_t num_removed = 0;
 
     // iterate twice to ensure AC-3 restoration works properly
@@ -155,7 +155,7 @@ bool word_domain_test_driver::test_letters_at_indicies_remove(
             result &= check_condition("letters_at_indicies num_words", letters_at_indicies_entries_equal(initial_num_words, letters_at_indices, true));
             result &= check_condition("letters_at_indicies num nodes", letters_at_indicies_entries_equal(initial_num_nodes, letters_at_indices, false));
             result &= check_condition("num_removed is 0 after undoing all removes", num_removed == 0);
-            result &= check_condition("domain size preserved during restore to init", init_domain_size == dut->get_word_map().size());
+            result &= check_condition("domain size preserved during restore to init", init_domain_size == dut->get_all_words().size());
         }
     }
 
@@ -180,7 +180,7 @@ bool word_domain_test_driver::test_letters_at_indicies_remove(
  * @param remove_params words to remove, in order, size must be equal to num_words_ground_truths, num_nodes_ground_truths
  * @param last_remaining if has value, expected singular domain value remaining after removes
  * @param initial_num_words initial state of num_words in letters_at_indices
- * @param initial_num_nodes initial state of nodes.size() in letters_at_indices
+ * @param initial_num_nodes initial state of num_nodes in letters_at_indices
  * @param num_words_ground_truths expected num_words after each call to remove_matching_words(), size must be equal as remove_params, num_nodes_ground_truths
  * @param num_nodes_ground_truths expected size() of children nodes after each call to remove_matching_words(), size must be equal as num_words_ground_truths, remove_params
  * @returns true iff letters_at_indices equal to expected at every step 
@@ -196,13 +196,13 @@ bool word_domain_test_driver::test_letters_at_indicies_remove_assign(
     cw_assert(remove_params.size() == num_words_ground_truths.size()); 
     cw_assert(num_nodes_ground_truths.size() == num_words_ground_truths.size()); 
 
-    for(word_t word : init_words) dut->add_word(word);
+    dut->add_words(init_words);
     letter_idx_table<letters_table_entry> letters_at_indices = dut->get_letters_at_indices();
 
     result &= check_condition("letters_at_indicies initial num_words", letters_at_indicies_entries_equal(initial_num_words, letters_at_indices, true));
     result &= check_condition("letters_at_indicies initial num nodes", letters_at_indicies_entries_equal(initial_num_nodes, letters_at_indices, false));
 
-    const size_t init_domain_size = dut->get_word_map().size();
+    const size_t init_domain_size = dut->get_all_words().size();
     size_t num_removed = 0;
 
     dut->start_new_ac3_call(); // simulate single AC-3 layer for all removes
@@ -255,7 +255,7 @@ bool word_domain_test_driver::test_letters_at_indicies_remove_assign(
     result &= check_condition("letters_at_indicies num_words", letters_at_indicies_entries_equal(initial_num_words, letters_at_indices, true));
     result &= check_condition("letters_at_indicies num nodes", letters_at_indicies_entries_equal(initial_num_nodes, letters_at_indices, false));
     result &= check_condition("num_removed is 0 after undoing all removes", num_removed == 0);
-    result &= check_condition("domain size preserved during restore to init", init_domain_size == dut->get_word_map().size());
+    result &= check_condition("domain size preserved during restore to init", init_domain_size == dut->get_all_words().size());
 
     return result;
 }
@@ -442,12 +442,275 @@ bool word_domain_test_driver::test_has_letters_at_index_with_letter_assigned(uin
     return result;
 }
 
+/**
+ * @brief test that a domain built from ids in a shared dictionary refers to words by those ids, 
+ *        and that adding a word absent from the dictionary leaves the dictionary untouched
+ * 
+ * @param filepath path to dictionary file
+ * @param pattern pattern of domain words, must match at least one word
+ * @returns true iff successful
+*/
+bool word_domain_test_driver::test_shared_table(const std::filesystem::path& filepath, const string& pattern) {
+    bool result = true;
+    shared_ptr<const word_dict> dict = word_dict::load(filepath);
+    const size_t dict_size = dict->size();
+    vector<word_id_t> ids = dict->find_match_ids(pattern);
+    result &= check_condition("shared table nonempty", !ids.empty());
+
+    for(const word_domain_backend backend : {word_domain_backend::TRIE, word_domain_backend::BITSET}) {
+        word_domain domain(name + " shared", dict, vector<word_id_t>(ids), backend);
+        result &= check_condition("shared table is dict", &domain.get_table() == dict.get());
+
+        vector<word_id_t> cur = domain.get_cur_domain_ids();
+        std::sort(cur.begin(), cur.end());
+        result &= check_condition("shared table ids", cur == ids);
+        result &= check_condition("shared table words", set_contents_equal(dict->find_matches(pattern), domain.find_matches(pattern), true));
+
+        // assigning by contents or by id refers to the same word
+        domain.assign_domain(dict->get_word(ids.back()));
+        result &= check_condition("shared table assign by contents", domain.get_cur_domain_ids() == vector<word_id_t>{ids.back()});
+        domain.unassign_domain();
+
+        // adding a word not in dict must not modify dict
+        const string absent(pattern.size(), 'z');
+        if(!dict->is_word(absent)) {
+            domain.add_word(word_t(absent));
+            result &= check_condition("shared table copied on write", &domain.get_table() != dict.get() && dict->size() == dict_size && !dict->is_word(absent));
+            result &= check_condition("shared table extended", domain.is_word(absent) && domain.size() == ids.size() + 1);
+            unordered_set<word_t> expected = dict->find_matches(pattern);
+            expected.insert(word_t(absent));
+            result &= check_condition("shared table remapped", set_contents_equal(expected, domain.find_matches(pattern), true));
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief differential test that a BITSET backend domain agrees with a TRIE backend domain through removes, assignment, and undos
+ * 
+ * @param domain words of domain, whose words must all be equal length
+ * @param remove_params params for remove_matching_words(), each in a new AC-3 layer, in order
+ * @returns true iff both domains agree at every step
+*/
+bool word_domain_test_driver::test_backends_equivalent(const vector<word_t>& domain, const vector<pair<uint, char> >& remove_params) {
+    bool result = true;
+    const uint len = domain.empty() ? 0u : static_cast<uint>(domain.front().word.size());
+
+    word_domain trie(name + " trie", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::TRIE);
+    word_domain bitset(name + " bitset", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::BITSET);
+    result &= check_condition("backends initial", domains_equal(trie, bitset, len, "initial"));
+
+    // remove in new layers
+    for(const auto& [index, letter] : remove_params) {
+        trie.start_new_ac3_call();
+        bitset.start_new_ac3_call();
+        result &= check_condition("backends remove count", trie.remove_matching_words(index, letter) == bitset.remove_matching_words(index, letter));
+        result &= check_condition("backends remove", domains_equal(trie, bitset, len, "remove"));
+    }
+
+    // assign remaining word, if any, and remove it
+    if(trie.size() > 0) {
+        const word_t value = trie.get_cur_domain().front();
+        trie.assign_domain(value);
+        bitset.assign_domain(value);
+        result &= check_condition("backends assign", domains_equal(trie, bitset, len, "assign"));
+
+        trie.start_new_ac3_call();
+        bitset.start_new_ac3_call();
+        result &= check_condition("backends remove assigned count", trie.remove_matching_words(0, value.word.at(0)) == bitset.remove_matching_words(0, value.word.at(0)));
+        result &= check_condition("backends remove assigned", domains_equal(trie, bitset, len, "remove assigned"));
+        result &= check_condition("backends undo assigned count", trie.undo_prev_ac3_call() == bitset.undo_prev_ac3_call());
+
+        trie.unassign_domain();
+        bitset.unassign_domain();
+        result &= check_condition("backends unassign", domains_equal(trie, bitset, len, "unassign"));
+    }
+
+    // undo all layers
+    for(size_t i = 0; i < remove_params.size(); ++i) {
+        result &= check_condition("backends undo count", trie.undo_prev_ac3_call() == bitset.undo_prev_ac3_call());
+        result &= check_condition("backends undo", domains_equal(trie, bitset, len, "undo"));
+    }
+    result &= check_condition("backends restored size", bitset.size() == domain.size());
+
+    return result;
+}
+
+/**
+ * @brief differential test that removing sets of letters at once from TRIE and BITSET domains agrees with removing each letter separately
+ * 
+ * @param domain words of domain, whose words must all be equal length
+ * @param remove_params params for remove_matching_words() with sets of letters, each in a new AC-3 layer, in order
+ * @returns true iff all domains agree at every step
+*/
+bool word_domain_test_driver::test_remove_letters(const vector<word_t>& domain, const vector<pair<uint, letter_bitset_t> >& remove_params) {
+    bool result = true;
+    const uint len = domain.empty() ? 0u : static_cast<uint>(domain.front().word.size());
+
+    word_domain reference(name + " reference", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::TRIE);
+    word_domain trie(name + " trie", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::TRIE);
+    word_domain bitset(name + " bitset", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::BITSET);
+
+    // remove in new layers, reference one letter at a time
+    for(const auto& [index, letters] : remove_params) {
+        reference.start_new_ac3_call();
+        trie.start_new_ac3_call();
+        bitset.start_new_ac3_call();
+
+        size_t expected = 0;
+        for(size_t i = 0; i < NUM_ENGLISH_LETTERS; ++i) {
+            if(letters[i]) expected += reference.remove_matching_words(index, static_cast<char>(i + 'a'));
+        }
+        result &= check_condition("remove letters trie count", trie.remove_matching_words(index, letters) == expected);
+        result &= check_condition("remove letters bitset count", bitset.remove_matching_words(index, letters) == expected);
+        result &= check_condition("remove letters trie", domains_equal(reference, trie, len, "remove letters trie"));
+        result &= check_condition("remove letters bitset", domains_equal(reference, bitset, len, "remove letters bitset"));
+    }
+
+    // undo all layers
+    for(size_t i = 0; i < remove_params.size(); ++i) {
+        const size_t expected = reference.undo_prev_ac3_call();
+        result &= check_condition("undo letters trie count", trie.undo_prev_ac3_call() == expected);
+        result &= check_condition("undo letters bitset count", bitset.undo_prev_ac3_call() == expected);
+        result &= check_condition("undo letters trie", domains_equal(reference, trie, len, "undo letters trie"));
+        result &= check_condition("undo letters bitset", domains_equal(reference, bitset, len, "undo letters bitset"));
+    }
+    result &= check_condition("remove letters restored size", trie.size() == domain.size() && bitset.size() == domain.size());
+
+    return result;
+}
+
+/**
+ * @brief differential test that removing single words from TRIE and BITSET domains removes exactly those words, and is undone
+ * 
+ * @param domain words of domain, whose words must all be equal length
+ * @param stride every stride-th word of domain is removed in one AC-3 layer, then each removed word again in another
+ * @returns true iff both domains agree with the words expected at every step
+*/
+bool word_domain_test_driver::test_remove_word(const vector<word_t>& domain, size_t stride) {
+    bool result = true;
+    const uint len = domain.empty() ? 0u : static_cast<uint>(domain.front().word.size());
+
+    word_domain trie(name + " trie", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::TRIE);
+    word_domain bitset(name + " bitset", unordered_set<word_t>(domain.begin(), domain.end()), word_domain_backend::BITSET);
+    const vector<word_id_t> ids = trie.get_cur_domain_ids();
+
+    // remove every stride-th word
+    trie.start_new_ac3_call();
+    bitset.start_new_ac3_call();
+    unordered_set<word_id_t> expected(ids.begin(), ids.end());
+    for(size_t i = 0; i < ids.size(); i += stride) {
+        result &= check_condition("remove word trie count", trie.remove_word(ids[i]) == 1ul);
+        result &= check_condition("remove word bitset count", bitset.remove_word(ids[i]) == 1ul);
+        expected.erase(ids[i]);
+    }
+    const vector<word_id_t> remaining = trie.get_cur_domain_ids();
+    result &= check_condition("remove word remaining", unordered_set<word_id_t>(remaining.begin(), remaining.end()) == expected);
+    result &= check_condition("remove word", domains_equal(trie, bitset, len, "remove word"));
+
+    // words already removed are absent
+    trie.start_new_ac3_call();
+    bitset.start_new_ac3_call();
+    for(size_t i = 0; i < ids.size(); i += stride) {
+        result &= check_condition("remove absent word trie count", trie.remove_word(ids[i]) == 0ul);
+        result &= check_condition("remove absent word bitset count", bitset.remove_word(ids[i]) == 0ul);
+    }
+    result &= check_condition("remove absent word", domains_equal(trie, bitset, len, "remove absent word"));
+
+    // assigned value is pruned only by its own word
+    if(!remaining.empty()) {
+        trie.assign_domain(remaining.front());
+        bitset.assign_domain(remaining.front());
+        trie.start_new_ac3_call();
+        bitset.start_new_ac3_call();
+        result &= check_condition("remove other word assigned", trie.remove_word(ids.front()) == 0ul && bitset.remove_word(ids.front()) == 0ul);
+        result &= check_condition("remove word assigned", trie.remove_word(remaining.front()) == 1ul && bitset.remove_word(remaining.front()) == 1ul);
+        result &= check_condition("remove word assigned size", trie.size() == 0ul && bitset.size() == 0ul);
+        result &= check_condition("undo remove word assigned", trie.undo_prev_ac3_call() == 1ul && bitset.undo_prev_ac3_call() == 1ul);
+        trie.unassign_domain();
+        bitset.unassign_domain();
+    }
+
+    // undo all layers
+    for(size_t i = 0; i < 2; ++i) {
+        result &= check_condition("undo remove word count", trie.undo_prev_ac3_call() == bitset.undo_prev_ac3_call());
+        result &= check_condition("undo remove word", domains_equal(trie, bitset, len, "undo remove word"));
+    }
+    result &= check_condition("remove word restored size", trie.size() == domain.size() && bitset.size() == domain.size());
+
+    return result;
+}
+
+/**
+ * @brief helper for test_backends_equivalent() to check all read functions of two domains agree
+ * 
+ * @param trie domain with TRIE backend
+ * @param bitset domain with BITSET backend
+ * @param len length of all words in domains
+ * @param desc description of step for logging
+ * @returns true iff domains agree
+*/
+bool word_domain_test_driver::domains_equal(const word_domain& trie, const word_domain& bitset, uint len, const string& desc) {
+    bool result = true;
+    const letter_bitset_t all_bitset = letter_bitset_t().set();
+
+    const vector<word_t> trie_domain = trie.get_cur_domain();
+    const vector<word_t> bitset_domain = bitset.get_cur_domain();
+    result &= check_condition(desc + " size", trie.size() == bitset.size());
+    result &= check_condition(desc + " cur domain", set_contents_equal(
+        unordered_set<word_t>(trie_domain.begin(), trie_domain.end()),
+        unordered_set<word_t>(bitset_domain.begin(), bitset_domain.end()),
+        true
+    ));
+
+    // lazily ranked domain must visit exactly the current domain, in increasing rank
+    for(const word_domain* domain : {&trie, &bitset}) {
+        vector<word_id_t> expected_ranked = domain->get_cur_domain_ids();
+        std::sort(expected_ranked.begin(), expected_ranked.end(), [domain](word_id_t lhs, word_id_t rhs) {
+            return domain->get_table().get_rank(lhs) < domain->get_table().get_rank(rhs);
+        });
+        vector<word_id_t> ranked;
+        for(const word_id_t id : domain->get_cur_domain_ranked()) {
+            ranked.push_back(id);
+        }
+        result &= check_condition(desc + " ranked domain", ranked == expected_ranked);
+    }
+
+    // incrementally maintained letters at each index must match those of the current domain
+    vector<letter_bitset_t> expected_letters(len);
+    for(const word_t& w : trie_domain) {
+        for(uint i = 0; i < len; ++i) {
+            expected_letters[i].set(static_cast<size_t>(w.word[i] - 'a'));
+        }
+    }
+
+    for(uint i = 0; i < len; ++i) {
+        result &= check_condition(desc + " letters at index", trie.get_all_letters_at_index(i) == bitset.get_all_letters_at_index(i));
+        result &= check_condition(desc + " letters at index match domain", trie.get_all_letters_at_index(i) == expected_letters[i]);
+
+        for(char c = 'a'; c <= 'z'; ++c) {
+            result &= check_condition(desc + " num letters at index", trie.num_letters_at_index(i, c) == bitset.num_letters_at_index(i, c));
+
+            for(uint j = 0; j < len; ++j) {
+                if(i != j || trie.is_assigned()) {
+                    result &= check_condition(desc + " letters at index with letter assigned", 
+                        trie.has_letters_at_index_with_letter_assigned(j, all_bitset, i, c) == bitset.has_letters_at_index_with_letter_assigned(j, all_bitset, i, c)
+                    );
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 /**
  * @brief checks if each entry's num_words or children.size() are equal
  * 
  * @param expected expected array
  * @param ground_truth ground truth letters_at_indices
- * @param test_num_words true -> test num_words, false -> test nodes.size() in ground_truth
+ * @param test_num_words true -> test num_words, false -> test num_nodes in ground_truth
  * @returns true iff arrays are equal
 */
 bool word_domain_test_driver::letters_at_indicies_entries_equal(
@@ -461,10 +724,10 @@ bool word_domain_test_driver::letters_at_indicies_entries_equal(
         for(uint j = 0; j < NUM_ENGLISH_LETTERS; j++) {
             if(
                 (test_num_words  && expected[i][j] != ground_truth[i][j].num_words) || 
-                (!test_num_words && expected[i][j] != ground_truth[i][j].nodes.size())
+                (!test_num_words && expected[i][j] != ground_truth[i][j].num_nodes)
             ) {
                 utils.log(WARNING, "letters_at_indicies_entries_equal() inequal at index: ", i, ", letter: ", j, ", test_num_words: ", test_num_words, 
-                    ", expected: ", expected[i][j], ", actual nodes: ", ground_truth[i][j].nodes.size(), ", actual words: ", ground_truth[i][j].num_words
+                    ", expected: ", expected[i][j], ", actual nodes: ", ground_truth[i][j].num_nodes, ", actual words: ", ground_truth[i][j].num_words
                 );
                 result = false;
             }
@@ -77,15 +77,27 @@ namespace word_domain_test_driver_ns {
             // basic directed test for has_letters_at_index_with_letter_assigned()
             bool test_has_letters_at_index_with_letter_assigned(uint len);
 
+            // differential test that BITSET backend behaves identically to TRIE backend
+            bool test_backends_equivalent(const vector<word_t>& domain, const vector<pair<uint, char> >& remove_params);
+
+            // differential test that removing sets of letters at once behaves identically to removing each letter separately
+            bool test_remove_letters(const vector<word_t>& domain, const vector<pair<uint, letter_bitset_t> >& remove_params);
+
+            // differential test of removing single words from TRIE and BITSET domains
+            bool test_remove_word(const vector<word_t>& domain, size_t stride);
+
+            // test that a domain of ids interned in a shared dictionary agrees with the dictionary, and copies it on write
+            bool test_shared_table(const std::filesystem::path& filepath, const string& pattern);
+
             // expose basic functionalities for dut 
-            void add_words(vector<word_t> words) { for(word_t w : words) dut->add_word(w); }
+            void add_words(vector<word_t> words) { dut->add_words(words); }
             void remove_words(vector<pair<uint, char> > remove_params) { 
                 for(const auto& pair : remove_params) dut->remove_matching_words(pair.first, pair.second);
             }
             void assign_domain(word_t word) { dut->assign_domain(word); }
             void unassign_domain() { dut->unassign_domain(); }
             vector<word_t> get_cur_domain() { return dut->get_cur_domain(); }
-            unordered_map<string, word_t>& get_word_map() { return dut->get_word_map(); }
+            vector<word_t> get_all_words() const { return dut->get_all_words(); }
             size_t remove_matching_words(uint index, char letter) { return dut->remove_matching_words(index, letter); }
             void start_new_ac3_call() { dut->start_new_ac3_call(); }
             size_t undo_prev_ac3_call() { return dut->undo_prev_ac3_call(); }
@@ -104,6 +116,9 @@ namespace word_domain_test_driver_ns {
                 bool test_num_words
             );
 
+            // helper function for test_backends_equivalent()
+            bool domains_equal(const word_domain& trie, const word_domain& bitset, uint len, const string& desc);
+
             // helper function for test_get_all_letters_at_index()
             letter_bitset_t get_all_letters_at_index(
                 uint index, letter_idx_table<uint>& num_words